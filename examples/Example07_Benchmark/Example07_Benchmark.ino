@@ -0,0 +1,37 @@
+/*
+ * Example07_Benchmark.ino
+ *
+ * This example measures the characteristic lookup by aid/iid (accessories_benchmark.c),
+ * the json writer (json_benchmark.c)
+ * and the crypto used by the HomeKit pairing and session (crypto_benchmark.c:
+ * srp, ed25519, curve25519, hkdf and chacha20poly1305 at 16B - 1KB)
+ * and the 3072-bit big number arithmetic (mp_benchmark.c).
+ * No WiFi or HomeKit accessory is needed, just open the Serial Monitor.
+ * The results are printed as one JSON object per line (see benchmark.h),
+ * so they can be saved and compared after changing the library or the settings.
+ *
+ * You should set the CPU Frequency to 160MHz as for the normal HomeKit usage.
+ * The srp part takes ~25s with the watchdogs disabled.
+ */
+
+#include <Arduino.h>
+
+extern "C" void accessories_benchmark_run();
+extern "C" void json_benchmark_run();
+extern "C" void crypto_benchmark_run();
+extern "C" void mp_benchmark_run();
+
+void setup() {
+	Serial.begin(115200);
+	delay(1000);
+	printf("\n{\"cpu_mhz\":%u,\"free_heap\":%u}\n", ESP.getCpuFreqMHz(), ESP.getFreeHeap());
+	accessories_benchmark_run();
+	json_benchmark_run();
+	crypto_benchmark_run();
+	mp_benchmark_run();
+	printf("{\"done\":true}\n");
+}
+
+void loop() {
+	delay(1000);
+}
@@ -0,0 +1,99 @@
+/*
+ * accessories_benchmark.c
+ *
+ * Times homekit_characteristic_by_aid_and_iid for bridges of 1 - 32 accessories,
+ * with the (aid, iid) index built by homekit_accessories_init ("characteristic_lookup")
+ * and with the linear scan used for accessories which are not initialized
+ * ("characteristic_lookup_linear"). The size is the count of characteristics.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <homekit/types.h>
+#include "benchmark.h"
+
+#define BENCH_SERVICES_PER_ACCESSORY 2
+#define BENCH_CHARACTERISTICS_PER_SERVICE 4
+
+static const int accessory_counts[] = { 1, 4, 16, 32 };
+
+static homekit_accessory_t **bench_accessories_new(int count) {
+	homekit_accessory_t **accessories = calloc(count + 1, sizeof(homekit_accessory_t *));
+	for (int a = 0; a < count; a++) {
+		homekit_accessory_t *accessory = calloc(1, sizeof(homekit_accessory_t));
+		accessory->services = calloc(BENCH_SERVICES_PER_ACCESSORY + 1, sizeof(homekit_service_t *));
+		for (int s = 0; s < BENCH_SERVICES_PER_ACCESSORY; s++) {
+			homekit_service_t *service = calloc(1, sizeof(homekit_service_t));
+			service->characteristics = calloc(BENCH_CHARACTERISTICS_PER_SERVICE + 1,
+					sizeof(homekit_characteristic_t *));
+			for (int c = 0; c < BENCH_CHARACTERISTICS_PER_SERVICE; c++) {
+				homekit_characteristic_t *ch = calloc(1, sizeof(homekit_characteristic_t));
+				ch->format = homekit_format_bool;
+				ch->permissions = homekit_permissions_paired_read;
+				service->characteristics[c] = ch;
+			}
+			accessory->services[s] = service;
+		}
+		accessories[a] = accessory;
+	}
+	return accessories;
+}
+
+static void bench_accessories_free(homekit_accessory_t **accessories) {
+	for (homekit_accessory_t **accessory_it = accessories; *accessory_it; accessory_it++) {
+		for (homekit_service_t **service_it = (*accessory_it)->services; *service_it; service_it++) {
+			for (homekit_characteristic_t **ch_it = (*service_it)->characteristics; *ch_it; ch_it++) {
+				free(*ch_it);
+			}
+			free((*service_it)->characteristics);
+			free(*service_it);
+		}
+		free((*accessory_it)->services);
+		free(*accessory_it);
+	}
+	free(accessories);
+}
+
+static int bench_lookup_all(homekit_accessory_t **accessories, int count) {
+	// iid 1 is the service, the characteristics of the first service are 2 - 5 and so on
+	const int ids_per_accessory = BENCH_SERVICES_PER_ACCESSORY * (BENCH_CHARACTERISTICS_PER_SERVICE + 1);
+	int found = 0;
+	for (int aid = 1; aid <= count; aid++) {
+		for (int iid = 1; iid <= ids_per_accessory; iid++) {
+			if (homekit_characteristic_by_aid_and_iid(accessories, aid, iid))
+				found++;
+		}
+	}
+	return found;
+}
+
+void accessories_benchmark_run() {
+	bench_mark_t mark;
+	const int iterations = 16;
+
+	for (size_t i = 0; i < sizeof(accessory_counts) / sizeof(*accessory_counts); i++) {
+		int count = accessory_counts[i];
+		homekit_accessory_t **accessories = bench_accessories_new(count);
+		homekit_accessories_init(accessories);
+
+		// Same accessories behind another array pointer, so the index is not used
+		homekit_accessory_t **linear = calloc(count + 1, sizeof(homekit_accessory_t *));
+		memcpy(linear, accessories, count * sizeof(homekit_accessory_t *));
+
+		int found = 0;
+		bench_begin(&mark);
+		for (int n = 0; n < iterations; n++) {
+			found = bench_lookup_all(accessories, count);
+		}
+		bench_end(&mark, "characteristic_lookup", found, iterations);
+
+		bench_begin(&mark);
+		for (int n = 0; n < iterations; n++) {
+			found = bench_lookup_all(linear, count);
+		}
+		bench_end(&mark, "characteristic_lookup_linear", found, iterations);
+
+		free(linear);
+		bench_accessories_free(accessories);
+	}
+}
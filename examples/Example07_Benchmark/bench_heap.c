@@ -0,0 +1,84 @@
+/*
+ * bench_heap.c
+ *
+ * The heap high-water mark of the host build (see bench_heap_peak in benchmark.h):
+ * malloc, calloc, realloc and free of glibc are wrapped to count the bytes in use.
+ * The device build takes it from umm_malloc instead.
+ */
+
+#include <stdlib.h>
+
+#if !defined(ARDUINO) && defined(__GLIBC__)
+
+#include <malloc.h>
+#include "benchmark.h"
+
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t count, size_t size);
+extern void *__libc_realloc(void *ptr, size_t size);
+extern void __libc_free(void *ptr);
+
+// Signed: memory of the other allocators of glibc (memalign...) is freed here too
+static long bench_heap_in_use = 0;
+static long bench_heap_base = 0;
+static long bench_heap_max = 0;
+
+static void bench_heap_add(long size) {
+	bench_heap_in_use += size;
+	if (bench_heap_in_use > bench_heap_max)
+		bench_heap_max = bench_heap_in_use;
+}
+
+void *malloc(size_t size) {
+	void *p = __libc_malloc(size);
+	if (p)
+		bench_heap_add(malloc_usable_size(p));
+	return p;
+}
+
+void *calloc(size_t count, size_t size) {
+	void *p = __libc_calloc(count, size);
+	if (p)
+		bench_heap_add(malloc_usable_size(p));
+	return p;
+}
+
+void *realloc(void *ptr, size_t size) {
+	long old_size = ptr ? malloc_usable_size(ptr) : 0;
+	void *p = __libc_realloc(ptr, size);
+	if (p) {
+		bench_heap_in_use -= old_size;
+		bench_heap_add(malloc_usable_size(p));
+	}
+	return p;
+}
+
+void free(void *ptr) {
+	if (ptr)
+		bench_heap_in_use -= malloc_usable_size(ptr);
+	__libc_free(ptr);
+}
+
+void bench_heap_reset() {
+	bench_heap_base = bench_heap_in_use;
+	bench_heap_max = bench_heap_in_use;
+}
+
+uint32_t bench_heap_peak(const bench_mark_t *mark) {
+	(void) mark;
+	return bench_heap_max - bench_heap_base;
+}
+
+#elif !defined(ARDUINO)
+
+#include "benchmark.h"
+
+void bench_heap_reset() {
+}
+
+uint32_t bench_heap_peak(const bench_mark_t *mark) {
+	(void) mark;
+	return 0;
+}
+
+#endif
@@ -0,0 +1,103 @@
+/*
+ * benchmark.h
+ *
+ * Shared timing helpers of the benchmarks in this example.
+ * Each result is printed as one line of JSON, e.g.
+ * {"name":"chacha20poly1305_encrypt","size":1024,"iterations":8,"ms":12,"cycles":1843200,"heap_used":0,"heap_peak":48}
+ * where ms and cycles are per iteration, heap_used is the free heap lost over the
+ * measured calls (memory kept by the call, e.g. the srp state) and heap_peak the
+ * most heap in use during the calls, above the heap in use at the start.
+ * Lines not starting with "{" are the normal library logs.
+ *
+ * The benchmarks are plain C and also build on a host (see port.h):
+ */
+// make -C <library>/extras/host bench
+
+#ifndef BENCHMARK_H_
+#define BENCHMARK_H_
+
+#include <stdio.h>
+#include <stdint.h>
+#include <port.h>
+#include <homekit_debug.h>
+
+#ifdef ARDUINO_ARCH_ESP8266
+
+#include <user_interface.h>
+
+static inline uint32_t bench_cycles() {
+	uint32_t ccount;
+	__asm__ __volatile__("rsr %0,ccount":"=a"(ccount));
+	return ccount;
+}
+
+#else
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+static inline uint32_t bench_cycles() {
+	return (uint32_t) __rdtsc();
+}
+#else
+static inline uint32_t bench_cycles() {
+	return 0;
+}
+#endif
+
+#endif
+
+typedef struct {
+	uint32_t ms;
+	uint32_t cycles;
+	uint32_t heap;
+} bench_mark_t;
+
+#ifdef ARDUINO_ARCH_ESP8266
+
+#include <umm_malloc/umm_malloc.h>
+
+static inline void bench_heap_reset() {
+	umm_free_heap_size_min_reset();
+}
+
+static inline uint32_t bench_heap_peak(const bench_mark_t *mark) {
+	return mark->heap - umm_free_heap_size_min();
+}
+
+#else
+
+// bench_heap.c
+void bench_heap_reset();
+uint32_t bench_heap_peak(const bench_mark_t *mark);
+
+#endif
+
+static inline void bench_begin(bench_mark_t *mark) {
+	mark->heap = system_get_free_heap_size();
+	bench_heap_reset();
+	mark->ms = millis();
+	mark->cycles = bench_cycles();
+}
+
+// Prints one result line: ms and cycles (per iteration) measured by the caller, and
+// the heap since bench_begin(mark)
+static inline void bench_report(const bench_mark_t *mark, const char *name, size_t size,
+		int iterations, uint32_t ms, uint32_t cycles) {
+	uint32_t heap_peak = bench_heap_peak(mark);
+	int32_t heap_used = (int32_t) mark->heap - (int32_t) system_get_free_heap_size();
+	printf("{\"name\":\"%s\",\"size\":%u,\"iterations\":%d,\"ms\":%u,\"cycles\":%u,\"heap_used\":%d,\"heap_peak\":%u}\n",
+			name, (unsigned) size, iterations, ms, cycles, heap_used, (unsigned) heap_peak);
+}
+
+static inline void bench_end(const bench_mark_t *mark, const char *name, size_t size, int iterations) {
+	uint32_t cycles = bench_cycles() - mark->cycles;
+	uint32_t ms = millis() - mark->ms;
+	bench_report(mark, name, size, iterations, ms / iterations, cycles / iterations);
+}
+
+void crypto_benchmark_run();
+void mp_benchmark_run();
+void accessories_benchmark_run();
+void json_benchmark_run();
+
+#endif /* BENCHMARK_H_ */
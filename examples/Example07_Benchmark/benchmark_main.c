@@ -0,0 +1,19 @@
+/*
+ * benchmark_main.c
+ *
+ * Entry point of the host build, the sketch calls the benchmarks in setup().
+ */
+
+#ifndef ARDUINO
+
+#include "benchmark.h"
+
+int main() {
+	accessories_benchmark_run();
+	json_benchmark_run();
+	crypto_benchmark_run();
+	mp_benchmark_run();
+	return 0;
+}
+
+#endif
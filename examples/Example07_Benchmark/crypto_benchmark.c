@@ -0,0 +1,276 @@
+/*
+ * crypto_benchmark.c
+ *
+ * Times the crypto used by pair-setup, pair-verify and the encrypted session.
+ */
+
+#include <string.h>
+#include <crypto.h>
+#include <watchdog.h>
+#include <esp_xpgm.h>
+#include <wolfssl/wolfcrypt/integer.h>
+#include "benchmark.h"
+
+static const size_t chacha_sizes[] = { 16, 64, 256, 1024 };
+
+static byte bench_buffer[1024 + 16];
+static byte bench_output[1024 + 16];
+
+static void benchmark_srp() {
+	bench_mark_t mark;
+	byte salt[16];
+	size_t salt_size = sizeof(salt);
+	byte public_key[384];
+	size_t public_key_size = sizeof(public_key);
+
+	Srp *srp = crypto_srp_new();
+
+	watchdog_disable_all();
+
+	bench_begin(&mark);
+	crypto_srp_init(srp, "Pair-Setup", "111-11-111");
+	bench_end(&mark, "srp_init", 0, 1);
+
+	crypto_srp_get_salt(srp, salt, &salt_size);
+
+	bench_begin(&mark);
+	crypto_srp_get_public_key(srp, public_key, &public_key_size);
+	bench_end(&mark, "srp_get_public_key", public_key_size, 1);
+
+	// The accessory public key is a valid A (non-zero mod N) for timing purpose
+	bench_begin(&mark);
+	crypto_srp_compute_key(srp, public_key, public_key_size, public_key, public_key_size);
+	bench_end(&mark, "srp_compute_key", public_key_size, 1);
+
+	watchdog_enable_all();
+
+	crypto_srp_free(srp);
+}
+
+// Pair Setup M3 as the server computes it: crypto_srp_compute_key_begin, the
+// crypto_srp_job_step calls of 4 Montgomery multiplications (HOMEKIT_SRP_STEP_OPERATIONS)
+// and crypto_srp_compute_key_finish, each in its own arduino_homekit_loop. Reports the
+// average step and the longest one (begin and finish included), which bounds the
+// arduino_homekit_loop latency while pairing.
+static void benchmark_srp_steps() {
+	bench_mark_t mark;
+	byte public_key[384];
+	size_t public_key_size = sizeof(public_key);
+	crypto_srp_job_t *job = NULL;
+
+	Srp *srp = crypto_srp_new();
+
+	// The steps are not interleaved with yield() here
+	watchdog_disable_all();
+
+	crypto_srp_init(srp, "Pair-Setup", "111-11-111");
+	crypto_srp_get_public_key(srp, public_key, &public_key_size);
+
+	int steps = 0;
+	uint32_t step_ms = 0;
+	uint32_t step_cycles = 0;
+	int r = 0;
+	bench_begin(&mark);
+	for (int state = 0; state < 3;) {
+		uint32_t ms = millis();
+		uint32_t cycles = bench_cycles();
+		if (state == 0) {
+			r = crypto_srp_compute_key_begin(srp, public_key, public_key_size, public_key,
+					public_key_size, &job);
+			state = 1;
+		} else if (state == 1) {
+			r = crypto_srp_job_step(job, 4);
+			if (r <= 0)
+				state = 2;
+		} else {
+			r = crypto_srp_compute_key_finish(srp, job, public_key, public_key_size,
+					public_key, public_key_size);
+			state = 3;
+		}
+		cycles = bench_cycles() - cycles;
+		ms = millis() - ms;
+		if (cycles > step_cycles)
+			step_cycles = cycles;
+		if (ms > step_ms)
+			step_ms = ms;
+		steps++;
+		if (r < 0)
+			break;
+	}
+	bench_end(&mark, "srp_compute_key_step", public_key_size, steps);
+	bench_report(&mark, "srp_compute_key_step_max", public_key_size, 1, step_ms, step_cycles);
+	watchdog_enable_all();
+	if (r)
+		ERROR("srp_compute_key_step failed (code %d)", r);
+
+	crypto_srp_job_free(job);
+	crypto_srp_free(srp);
+}
+
+// The SRP group modulus in crypto.c (PROGMEM)
+extern const byte N[];
+
+// base^b mod N with a 256-bit b, by mp_exptmod (crypto_srp_exptmod with ESP_SRP_EXPTMOD)
+// and by s_mp_exptmod, the generic exponentiation of integer.c. The generator g = 5
+// takes the fixed-base comb, as in srp_get_public_key, other bases the window.
+static void benchmark_srp_exptmod_base(mp_int *base, mp_int *b, mp_int *n, const char *name) {
+	bench_mark_t mark;
+	mp_int y1, y2;
+
+	mp_init(&y1);
+	mp_init(&y2);
+
+	watchdog_disable_all();
+
+	bench_begin(&mark);
+	mp_exptmod(base, b, n, &y1);
+	bench_end(&mark, name, 384, 1);
+
+	bench_begin(&mark);
+	s_mp_exptmod(base, b, n, &y2, 0);
+	bench_end(&mark, "s_mp_exptmod", 384, 1);
+
+	watchdog_enable_all();
+
+	if (mp_cmp(&y1, &y2) != MP_EQ) {
+		ERROR("%s result differs from s_mp_exptmod", name);
+	}
+
+	mp_clear(&y1);
+	mp_clear(&y2);
+}
+
+static void benchmark_srp_exptmod() {
+	mp_int base, b, n;
+
+	mp_init(&base);
+	mp_init(&b);
+	mp_init(&n);
+
+	memcpy_P(bench_buffer, N, 384);
+	mp_read_unsigned_bin(&n, bench_buffer, 384);
+	memset(bench_buffer, 0xa5, 32);
+	mp_read_unsigned_bin(&b, bench_buffer, 32);
+
+	mp_set(&base, 5);
+	benchmark_srp_exptmod_base(&base, &b, &n, "srp_exptmod_g");
+
+	memset(bench_buffer, 0x5a, 384);
+	mp_read_unsigned_bin(&base, bench_buffer, 383);
+	benchmark_srp_exptmod_base(&base, &b, &n, "srp_exptmod");
+
+	mp_clear(&base);
+	mp_clear(&b);
+	mp_clear(&n);
+}
+
+static void benchmark_ed25519() {
+	bench_mark_t mark;
+	byte signature[64];
+	size_t signature_size = sizeof(signature);
+	ed25519_key key;
+
+	crypto_ed25519_init(&key);
+	crypto_ed25519_generate(&key);
+
+	memset(bench_buffer, 0x5a, 100);
+
+	bench_begin(&mark);
+	crypto_ed25519_sign(&key, bench_buffer, 100, signature, &signature_size);
+	bench_end(&mark, "ed25519_sign", 100, 1);
+
+	bench_begin(&mark);
+	int r = crypto_ed25519_verify(&key, bench_buffer, 100, signature, signature_size);
+	bench_end(&mark, "ed25519_verify", 100, 1);
+	if (r) {
+		ERROR("ed25519_verify failed (%d)", r);
+	}
+}
+
+static void benchmark_curve25519() {
+	bench_mark_t mark;
+	curve25519_key my_key;
+	curve25519_key their_key;
+	byte shared[32];
+	size_t shared_size = sizeof(shared);
+
+	crypto_curve25519_init(&my_key);
+	crypto_curve25519_init(&their_key);
+
+	bench_begin(&mark);
+	crypto_curve25519_generate(&my_key);
+	bench_end(&mark, "curve25519_generate", 32, 1);
+	crypto_curve25519_generate(&their_key);
+
+	bench_begin(&mark);
+	crypto_curve25519_shared_secret(&my_key, &their_key, shared, &shared_size);
+	bench_end(&mark, "curve25519_shared_secret", shared_size, 1);
+
+	crypto_curve25519_done(&my_key);
+	crypto_curve25519_done(&their_key);
+}
+
+static void benchmark_hkdf() {
+	bench_mark_t mark;
+	const int iterations = 16;
+	byte key[32];
+	byte output[32];
+	size_t output_size;
+
+	memset(key, 0x11, sizeof(key));
+
+	bench_begin(&mark);
+	for (int i = 0; i < iterations; i++) {
+		output_size = sizeof(output);
+		crypto_hkdf(key, sizeof(key), (const byte *) "Control-Salt", 12,
+				(const byte *) "Control-Read-Encryption-Key", 27, output, &output_size);
+	}
+	bench_end(&mark, "hkdf", sizeof(key), iterations);
+}
+
+static void benchmark_chacha20poly1305() {
+	bench_mark_t mark;
+	const int iterations = 8;
+	byte key[32];
+	byte nonce[12];
+	byte aad[2];
+
+	memset(key, 0x22, sizeof(key));
+	memset(nonce, 0, sizeof(nonce));
+
+	for (size_t s = 0; s < sizeof(chacha_sizes) / sizeof(*chacha_sizes); s++) {
+		size_t size = chacha_sizes[s];
+		size_t encrypted_size = 0;
+		size_t decrypted_size = 0;
+
+		aad[0] = size % 256;
+		aad[1] = size / 256;
+		memset(bench_buffer, 0x33, size);
+
+		bench_begin(&mark);
+		for (int i = 0; i < iterations; i++) {
+			encrypted_size = sizeof(bench_output);
+			crypto_chacha20poly1305_encrypt(key, nonce, aad, sizeof(aad),
+					bench_buffer, size, bench_output, &encrypted_size);
+		}
+		bench_end(&mark, "chacha20poly1305_encrypt", size, iterations);
+
+		bench_begin(&mark);
+		for (int i = 0; i < iterations; i++) {
+			decrypted_size = sizeof(bench_buffer);
+			crypto_chacha20poly1305_decrypt(key, nonce, aad, sizeof(aad),
+					bench_output, encrypted_size, bench_buffer, &decrypted_size);
+		}
+		bench_end(&mark, "chacha20poly1305_decrypt", size, iterations);
+	}
+}
+
+void crypto_benchmark_run() {
+	benchmark_chacha20poly1305();
+	benchmark_hkdf();
+	benchmark_curve25519();
+	benchmark_ed25519();
+	benchmark_srp_exptmod();
+	benchmark_srp();
+	benchmark_srp_steps();
+}
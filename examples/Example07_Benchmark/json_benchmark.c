@@ -0,0 +1,184 @@
+/*
+ * json_benchmark.c
+ *
+ * Times json.c writing a typical GET /characteristics or EVENT body:
+ * {"characteristics":[{"aid":1,"iid":10,"value":23.5},...]} with integer,
+ * float and boolean values ("json_characteristics"), and the number writers
+ * alone ("json_uint32", "json_float"). The "_snprintf" entries time the same
+ * numbers formatted the way json.c did before, with snprintf into a temporary,
+ * and a "match" line tells whether both produced the same values.
+ * The size is the count of bytes written.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <json.h>
+#include "benchmark.h"
+
+#define BENCH_JSON_CHARACTERISTICS 20
+#define BENCH_JSON_NUMBERS 100
+
+static size_t json_bench_size;
+
+// Output of a stream kept for comparison, see json_bench_match
+typedef struct {
+	char data[2048];
+	size_t size;
+} json_bench_output_t;
+
+static void json_bench_on_flush(uint8_t *buffer, size_t size, void *context) {
+	json_bench_size += size;
+
+	json_bench_output_t *output = context;
+	if (output && output->size + size < sizeof(output->data)) {
+		memcpy(output->data + output->size, buffer, size);
+		output->size += size;
+		output->data[output->size] = 0;
+	}
+}
+
+static void json_bench_characteristics(json_stream *json) {
+	json_object_start(json);
+	json_key(json, "characteristics");
+	json_array_start(json);
+	for (int i = 0; i < BENCH_JSON_CHARACTERISTICS; i++) {
+		json_object_start(json);
+		json_key(json, "aid");
+		json_uint32(json, 1 + i / 4);
+		json_key(json, "iid");
+		json_uint32(json, 8 + i);
+		json_key(json, "value");
+		switch (i % 4) {
+		case 0:
+			json_float(json, 20.0f + i * 0.1f);
+			break;
+		case 1:
+			json_boolean(json, i & 2);
+			break;
+		case 2:
+			json_uint8(json, i * 5);
+			break;
+		default:
+			json_integer(json, -i * 100);
+			break;
+		}
+		json_object_end(json);
+	}
+	json_array_end(json);
+	json_object_end(json);
+	json_flush(json);
+}
+
+typedef void (*json_bench_writer_t)(json_stream *json, int i);
+
+static void json_bench_uint32(json_stream *json, int i) {
+	json_uint32(json, i * 40503);
+}
+
+static void json_bench_float(json_stream *json, int i) {
+	json_float(json, i * 0.25f - 10.1f);
+}
+
+// The formatting json.c used before json_format_*: snprintf into a temporary
+// that is then copied into the stream. Items are separated here since
+// json_raw leaves the array state alone.
+static void json_bench_snprintf(json_stream *json, int i, const char *buffer, int size) {
+	if (i)
+		json_raw(json, (const uint8_t *)",", 1);
+	json_raw(json, (const uint8_t *)buffer, size);
+}
+
+static void json_bench_uint32_snprintf(json_stream *json, int i) {
+	char buffer[11];
+	json_bench_snprintf(json, i, buffer, snprintf(buffer, sizeof(buffer), "%u", (unsigned)(i * 40503)));
+}
+
+static void json_bench_float_snprintf(json_stream *json, int i) {
+	char buffer[32];
+	json_bench_snprintf(json, i, buffer, snprintf(buffer, sizeof(buffer), "%1.15g", i * 0.25f - 10.1f));
+}
+
+static void json_bench_numbers(json_stream *json, json_bench_writer_t writer) {
+	json_array_start(json);
+	for (int i = 0; i < BENCH_JSON_NUMBERS; i++) {
+		writer(json, i);
+	}
+	json_array_end(json);
+	json_flush(json);
+}
+
+static void json_bench_run_numbers(const char *name, json_bench_writer_t writer, int iterations) {
+	bench_mark_t mark;
+
+	json_bench_size = 0;
+	bench_begin(&mark);
+	for (int n = 0; n < iterations; n++) {
+		json_stream *json = json_new(512, json_bench_on_flush, NULL);
+		json_bench_numbers(json, writer);
+		json_free(json);
+	}
+	bench_end(&mark, name, json_bench_size / iterations, iterations);
+}
+
+// Writes the numbers with both writers and compares them item by item. The
+// integers have to be the same text; "%1.15g" prints more digits of a float
+// than needed, so floats only have to parse back to the same value.
+static void json_bench_match(const char *name, json_bench_writer_t writer,
+		json_bench_writer_t reference, bool is_float) {
+	static json_bench_output_t output[2];
+	json_bench_writer_t writers[2] = { writer, reference };
+
+	for (int w = 0; w < 2; w++) {
+		output[w].size = 0;
+		output[w].data[0] = 0;
+		json_stream *json = json_new(512, json_bench_on_flush, &output[w]);
+		json_bench_numbers(json, writers[w]);
+		json_free(json);
+	}
+
+	bool match = output[0].data[0] == '[' && output[1].data[0] == '[';
+	const char *a = output[0].data + 1;
+	const char *b = output[1].data + 1;
+	int count = 0;
+	while (match && *a != ']' && *b != ']') {
+		size_t a_size = strcspn(a, ",]");
+		size_t b_size = strcspn(b, ",]");
+		if (is_float) {
+			match = strtof(a, NULL) == strtof(b, NULL);
+		} else {
+			match = a_size == b_size && !memcmp(a, b, a_size);
+		}
+		a += a_size;
+		b += b_size;
+		if (*a == ',')
+			a++;
+		if (*b == ',')
+			b++;
+		count++;
+	}
+	match = match && *a == ']' && *b == ']' && count == BENCH_JSON_NUMBERS;
+	printf("{\"name\":\"%s\",\"match\":%s}\n", name, match ? "true" : "false");
+}
+
+void json_benchmark_run() {
+	bench_mark_t mark;
+	const int iterations = 32;
+
+	json_bench_size = 0;
+	bench_begin(&mark);
+	for (int n = 0; n < iterations; n++) {
+		json_stream *json = json_new(512, json_bench_on_flush, NULL);
+		json_bench_characteristics(json);
+		json_free(json);
+	}
+	bench_end(&mark, "json_characteristics", json_bench_size / iterations, iterations);
+
+	json_bench_run_numbers("json_uint32", json_bench_uint32, iterations);
+	json_bench_run_numbers("json_uint32_snprintf", json_bench_uint32_snprintf, iterations);
+	json_bench_match("json_uint32", json_bench_uint32, json_bench_uint32_snprintf, false);
+
+	json_bench_run_numbers("json_float", json_bench_float, iterations);
+	json_bench_run_numbers("json_float_snprintf", json_bench_float_snprintf, iterations);
+	json_bench_match("json_float", json_bench_float, json_bench_float_snprintf, true);
+}
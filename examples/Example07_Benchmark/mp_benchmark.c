@@ -0,0 +1,135 @@
+/*
+ * mp_benchmark.c
+ *
+ * Times the big number arithmetic of wolfcrypt/src/integer.c on 3072-bit numbers
+ * (the SRP group size): mp_mul and mp_sqr, the comba kernels if the operands fit
+ * MP_WARRAY ("mp_mul", "mp_sqr"), the schoolbook s_mp_mul_digs and s_mp_sqr
+ * ("s_mp_mul", "s_mp_sqr") and mp_mulmod. Compare a build with MP_16BIT and one
+ * with ESP_MP_32BIT (user_settings.h).
+ * Before timing, the results of mp_mul and mp_sqr are checked against the
+ * schoolbook ones for operands of 1 to 384 bytes, random and all ones (the
+ * largest carries), a mismatch is logged as an error.
+ */
+
+#include <string.h>
+#include <user_settings.h>
+#include <wolfssl/wolfcrypt/integer.h>
+#include "benchmark.h"
+
+#define BENCH_MP_SIZE 384
+
+static byte bench_mp_buffer[BENCH_MP_SIZE];
+static uint32_t bench_mp_seed = 0x12345678;
+
+static void bench_mp_random(mp_int *a, size_t size, bool ones) {
+	for (size_t i = 0; i < size; i++) {
+		// xorshift32, the same numbers on every run
+		bench_mp_seed ^= bench_mp_seed << 13;
+		bench_mp_seed ^= bench_mp_seed >> 17;
+		bench_mp_seed ^= bench_mp_seed << 5;
+		bench_mp_buffer[i] = ones ? 0xff : bench_mp_seed;
+	}
+	mp_read_unsigned_bin(a, bench_mp_buffer, size);
+}
+
+static int bench_mp_check() {
+	static const size_t sizes[] = { 1, 2, 3, 7, 16, 32, 64, 100, 128, 255, 256, 383, 384 };
+	mp_int a, b, c1, c2;
+	int errors = 0;
+
+	mp_init(&a);
+	mp_init(&b);
+	mp_init(&c1);
+	mp_init(&c2);
+
+	for (size_t i = 0; i < sizeof(sizes) / sizeof(*sizes); i++) {
+		for (size_t j = 0; j < sizeof(sizes) / sizeof(*sizes); j++) {
+			for (int ones = 0; ones < 2; ones++) {
+				bench_mp_random(&a, sizes[i], ones);
+				bench_mp_random(&b, sizes[j], ones);
+
+				mp_mul(&a, &b, &c1);
+				s_mp_mul(&a, &b, &c2);
+				if (mp_cmp(&c1, &c2) != MP_EQ) {
+					ERROR("mp_mul differs from s_mp_mul (%u x %u bytes)",
+							(unsigned) sizes[i], (unsigned) sizes[j]);
+					errors++;
+				}
+			}
+		}
+
+		for (int ones = 0; ones < 2; ones++) {
+			bench_mp_random(&a, sizes[i], ones);
+
+			mp_sqr(&a, &c1);
+			s_mp_sqr(&a, &c2);
+			if (mp_cmp(&c1, &c2) != MP_EQ) {
+				ERROR("mp_sqr differs from s_mp_sqr (%u bytes)", (unsigned) sizes[i]);
+				errors++;
+			}
+		}
+	}
+
+	mp_clear(&a);
+	mp_clear(&b);
+	mp_clear(&c1);
+	mp_clear(&c2);
+
+	return errors;
+}
+
+void mp_benchmark_run() {
+	bench_mark_t mark;
+	const int iterations = 16;
+	mp_int a, b, n, c;
+
+	if (bench_mp_check()) {
+		return;
+	}
+
+	mp_init(&a);
+	mp_init(&b);
+	mp_init(&n);
+	mp_init(&c);
+
+	bench_mp_random(&a, BENCH_MP_SIZE, false);
+	bench_mp_random(&b, BENCH_MP_SIZE, false);
+	bench_mp_random(&n, BENCH_MP_SIZE, false);
+	mp_mod(&a, &n, &a);
+	mp_mod(&b, &n, &b);
+
+	bench_begin(&mark);
+	for (int i = 0; i < iterations; i++) {
+		mp_mul(&a, &b, &c);
+	}
+	bench_end(&mark, "mp_mul", BENCH_MP_SIZE, iterations);
+
+	bench_begin(&mark);
+	for (int i = 0; i < iterations; i++) {
+		s_mp_mul(&a, &b, &c);
+	}
+	bench_end(&mark, "s_mp_mul", BENCH_MP_SIZE, iterations);
+
+	bench_begin(&mark);
+	for (int i = 0; i < iterations; i++) {
+		mp_sqr(&a, &c);
+	}
+	bench_end(&mark, "mp_sqr", BENCH_MP_SIZE, iterations);
+
+	bench_begin(&mark);
+	for (int i = 0; i < iterations; i++) {
+		s_mp_sqr(&a, &c);
+	}
+	bench_end(&mark, "s_mp_sqr", BENCH_MP_SIZE, iterations);
+
+	bench_begin(&mark);
+	for (int i = 0; i < iterations; i++) {
+		mp_mulmod(&a, &b, &n, &c);
+	}
+	bench_end(&mark, "mp_mulmod", BENCH_MP_SIZE, iterations);
+
+	mp_clear(&a);
+	mp_clear(&b);
+	mp_clear(&n);
+	mp_clear(&c);
+}
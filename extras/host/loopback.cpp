@@ -0,0 +1,563 @@
+/*
+ * loopback.cpp
+ *
+ * Host build: a controller which pairs with the accessory server over 127.0.0.1,
+ * as an iOS device does (Pair Setup M1-M6, Pair Verify M1-M4), then drives
+ * encrypted requests through homekit_server_process:
+ * - GET /accessories, larger than the TCP send buffer, read only after a while: the
+ *   server writes it in parts as the controller reads, and an EVENT waits for its end
+ * - PUT /characteristics with missing separators, answered 400
+ * - a subscription ("ev") which has to survive homekit_update_config_number, and
+ *   the EVENT of a notified change
+ * - a write of the switch, which reaches its setter
+ * Each step prints one line, the exit code is 0 if all of them passed.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <string>
+
+#include <Arduino.h>
+#include <ESP8266mDNS.h>
+#include <homekit/homekit.h>
+#include <homekit/tlv.h>
+#include "arduino_homekit_server.h"
+#include "crypto.h"
+
+// HOMEKIT_SERVER_PORT of arduino_homekit_server.cpp
+#define LOOPBACK_PORT 5556
+// Small, so that the kernel does not take the whole response for the controller
+#define LOOPBACK_RCVBUF 4096
+#define LOOPBACK_TIMEOUT 30000
+
+extern "C" {
+extern homekit_server_config_t loopback_config;
+extern homekit_characteristic_t loopback_switch_on;
+extern int loopback_switch_writes;
+void loopback_switch_notify(bool on);
+
+// loopback_srp.c
+int loopback_srp_proof(const char *password, const byte *salt, size_t salt_size,
+		const byte *server_public_key, size_t server_public_key_size,
+		byte *public_key, size_t *public_key_size, byte *proof, size_t *proof_size);
+int loopback_srp_verify(const byte *proof, size_t proof_size);
+int loopback_srp_hkdf(const char *salt, const char *info, byte *output);
+void loopback_srp_free();
+}
+
+void homekit_update_config_number();
+extern homekit_server_t *running_server;
+
+static const char loopback_pairing_id[] = "01234567-89AB-CDEF-0123-456789ABCDEF";
+
+static int controller = -1;
+static std::string input;    // as received
+static std::string plain;    // input decrypted, once the session is encrypted
+static bool encrypted = false;
+static byte read_key[32];    // accessory to controller
+static byte write_key[32];   // controller to accessory
+static uint64_t count_reads = 0;
+static uint64_t count_writes = 0;
+
+typedef struct {
+	int status;        // 0 until a whole response is read
+	bool event;        // EVENT/1.0 instead of HTTP/1.1
+	std::string body;
+} loopback_response_t;
+
+static int failures = 0;
+static size_t output_peak = 0;
+
+static void loopback_result(const char *step, bool ok) {
+	printf("loopback: %s %s\n", step, ok ? "ok" : "FAILED");
+	if (!ok)
+		failures++;
+}
+
+static void loopback_nonce(byte *nonce, uint64_t count) {
+	memset(nonce, 0, 12);
+	for (int i = 4; i < 12; i++) {
+		nonce[i] = count & 0xFF;
+		count >>= 8;
+	}
+}
+
+static bool loopback_connect() {
+	controller = socket(AF_INET, SOCK_STREAM, 0);
+	int size = LOOPBACK_RCVBUF;
+	setsockopt(controller, SOL_SOCKET, SO_RCVBUF, &size, sizeof(size));
+
+	struct sockaddr_in address;
+	memset(&address, 0, sizeof(address));
+	address.sin_family = AF_INET;
+	address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	address.sin_port = htons(LOOPBACK_PORT);
+	if (connect(controller, (struct sockaddr*) &address, sizeof(address)) < 0) {
+		perror("connect");
+		return false;
+	}
+	fcntl(controller, F_SETFL, fcntl(controller, F_GETFL) | O_NONBLOCK);
+	return true;
+}
+
+static void loopback_send(const byte *data, size_t size) {
+	while (size) {
+		ssize_t r = send(controller, data, size, MSG_NOSIGNAL);
+		if (r < 0) {
+			if (errno != EAGAIN && errno != EWOULDBLOCK)
+				return;
+			arduino_homekit_loop(); // let the server read
+			continue;
+		}
+		data += r;
+		size -= r;
+	}
+}
+
+// Sends an HTTP request, in encrypted frames of at most 1024 bytes once paired
+static void loopback_request(const char *method, const char *path, const char *content_type,
+		const std::string &body) {
+	char headers[256];
+	snprintf(headers, sizeof(headers), "%s %s HTTP/1.1\r\nHost: loopback\r\n"
+			"Content-Type: %s\r\nContent-Length: %u\r\n\r\n", method, path, content_type,
+			(unsigned) body.size());
+	std::string request = std::string(headers) + body;
+
+	if (!encrypted) {
+		loopback_send((const byte*) request.data(), request.size());
+		return;
+	}
+
+	for (size_t offset = 0; offset < request.size(); offset += 1024) {
+		size_t size = request.size() - offset;
+		if (size > 1024)
+			size = 1024;
+
+		byte frame[2 + 1024 + 16];
+		frame[0] = size % 256;
+		frame[1] = size / 256;
+		byte nonce[12];
+		loopback_nonce(nonce, count_writes++);
+		size_t encrypted_size = sizeof(frame) - 2;
+		crypto_chacha20poly1305_encrypt(write_key, nonce, frame, 2,
+				(const byte*) request.data() + offset, size, frame + 2, &encrypted_size);
+		loopback_send(frame, 2 + encrypted_size);
+	}
+}
+
+// Reads what the server sent, and decrypts the whole frames of it
+static bool loopback_receive() {
+	byte buffer[2048];
+	ssize_t r;
+	while ((r = recv(controller, buffer, sizeof(buffer), MSG_DONTWAIT)) > 0) {
+		input.append((const char*) buffer, r);
+	}
+
+	while (encrypted && input.size() >= 2) {
+		size_t size = (byte) input[0] | ((byte) input[1] << 8);
+		if (input.size() < 2 + size + 16)
+			break;
+
+		byte nonce[12];
+		loopback_nonce(nonce, count_reads++);
+		byte decrypted[1024 + 16];
+		size_t decrypted_size = sizeof(decrypted);
+		if (crypto_chacha20poly1305_decrypt(read_key, nonce, (const byte*) input.data(), 2,
+				(const byte*) input.data() + 2, size + 16, decrypted, &decrypted_size)) {
+			printf("loopback: failed to decrypt a frame\n");
+			return false;
+		}
+		plain.append((const char*) decrypted, size);
+		input.erase(0, 2 + size + 16);
+	}
+	return r != 0;
+}
+
+// Takes a whole response out of the received data, if there is one
+static bool loopback_parse(loopback_response_t *response) {
+	std::string &data = encrypted ? plain : input;
+	size_t headers_end = data.find("\r\n\r\n");
+	if (headers_end == std::string::npos)
+		return false;
+
+	std::string headers = data.substr(0, headers_end + 2);
+	size_t offset = headers_end + 4;
+	std::string body;
+	if (headers.find("Transfer-Encoding: chunked") != std::string::npos) {
+		while (true) {
+			size_t line_end = data.find("\r\n", offset);
+			if (line_end == std::string::npos)
+				return false;
+			size_t size = strtoul(data.c_str() + offset, NULL, 16);
+			if (data.size() < line_end + 2 + size + 2)
+				return false;
+			body.append(data, line_end + 2, size);
+			offset = line_end + 2 + size + 2;
+			if (!size)
+				break;
+		}
+	} else {
+		size_t length_pos = headers.find("Content-Length: ");
+		size_t size = length_pos == std::string::npos ? 0 : strtoul(headers.c_str() + length_pos + 16, NULL, 10);
+		if (data.size() < offset + size)
+			return false;
+		body = data.substr(offset, size);
+		offset += size;
+	}
+
+	response->event = !headers.compare(0, 6, "EVENT/");
+	response->status = atoi(headers.c_str() + headers.find(' ') + 1);
+	response->body = body;
+	data.erase(0, offset);
+	return true;
+}
+
+// Runs the server without reading anything, as a slow controller, and keeps the
+// largest output queue of a client meanwhile
+static void loopback_serve(int rounds) {
+	for (int i = 0; i < rounds; i++) {
+		arduino_homekit_loop();
+		for (client_context_t *c = running_server->clients; c; c = c->next) {
+			if (c->output_size > output_peak)
+				output_peak = c->output_size;
+		}
+		delay(1);
+	}
+}
+
+// Runs the server until a whole response arrives
+static bool loopback_response(loopback_response_t *response) {
+	response->status = 0;
+	uint32_t start = millis();
+	while ((uint32_t) (millis() - start) < LOOPBACK_TIMEOUT) {
+		arduino_homekit_loop();
+		if (!loopback_receive()) {
+			printf("loopback: the server closed the connection\n");
+			return false;
+		}
+		if (loopback_parse(response))
+			return true;
+		delay(1);
+	}
+	printf("loopback: no response\n");
+	return false;
+}
+
+static bool loopback_tlv_request(const char *path, tlv_values_t *request, tlv_values_t *response) {
+	size_t size = 0;
+	tlv_format(request, NULL, &size);
+	std::string body(size, 0);
+	tlv_format(request, (byte*) &body[0], &size);
+	tlv_free(request);
+
+	loopback_request("POST", path, "application/pairing+tlv8", body);
+	loopback_response_t http;
+	if (!loopback_response(&http) || http.status != 200)
+		return false;
+	if (tlv_parse((const byte*) http.body.data(), http.body.size(), response))
+		return false;
+	return tlv_get_integer_value(response, TLVType_Error, 0) == 0;
+}
+
+static std::string loopback_tlv_value(const tlv_values_t *values, byte type) {
+	tlv_t *tlv = tlv_get_value(values, type);
+	return tlv ? std::string((const char*) tlv->value, tlv->size) : std::string();
+}
+
+static bool loopback_hkdf(const byte *key, size_t key_size, const char *salt, const char *info,
+		byte *output) {
+	size_t size = 32;
+	return !crypto_hkdf(key, key_size, (const byte*) salt, strlen(salt), (const byte*) info,
+			strlen(info), output, &size);
+}
+
+static std::string loopback_encrypt(const byte *key, const char *nonce_name, tlv_values_t *values) {
+	size_t size = 0;
+	tlv_format(values, NULL, &size);
+	std::string data(size, 0);
+	tlv_format(values, (byte*) &data[0], &size);
+	tlv_free(values);
+
+	byte nonce[12] = { 0 };
+	memcpy(nonce + 4, nonce_name, 8);
+	std::string encrypted_data(size + 16, 0);
+	size_t encrypted_size = encrypted_data.size();
+	crypto_chacha20poly1305_encrypt(key, nonce, NULL, 0, (const byte*) data.data(), size,
+			(byte*) &encrypted_data[0], &encrypted_size);
+	return encrypted_data;
+}
+
+static bool loopback_decrypt(const byte *key, const char *nonce_name, const std::string &data,
+		tlv_values_t *values) {
+	byte nonce[12] = { 0 };
+	memcpy(nonce + 4, nonce_name, 8);
+	std::string decrypted(data.size(), 0);
+	size_t decrypted_size = decrypted.size();
+	if (data.size() < 16 || crypto_chacha20poly1305_decrypt(key, nonce, NULL, 0,
+			(const byte*) data.data(), data.size(), (byte*) &decrypted[0], &decrypted_size))
+		return false;
+	return !tlv_parse((const byte*) decrypted.data(), decrypted_size, values);
+}
+
+static ed25519_key *controller_key;
+static byte controller_public_key[32];
+static ed25519_key accessory_key;
+static std::string accessory_id;
+
+static bool loopback_pair_setup() {
+	tlv_values_t *request = tlv_new();
+	tlv_add_integer_value(request, TLVType_State, 1, 1);
+	tlv_add_integer_value(request, TLVType_Method, 1, 0);
+	tlv_values_t *m2 = tlv_new();
+	bool ok = loopback_tlv_request("/pair-setup", request, m2)
+			&& tlv_get_integer_value(m2, TLVType_State, 0) == 2;
+
+	// M3: the SRP public key and proof of the setup code
+	std::string salt = loopback_tlv_value(m2, TLVType_Salt);
+	std::string server_public_key = loopback_tlv_value(m2, TLVType_PublicKey);
+	tlv_free(m2);
+	byte public_key[384], proof[64];
+	size_t public_key_size = sizeof(public_key), proof_size = sizeof(proof);
+	ok = ok && !loopback_srp_proof(loopback_config.password, (const byte*) salt.data(),
+			salt.size(), (const byte*) server_public_key.data(), server_public_key.size(),
+			public_key, &public_key_size, proof, &proof_size);
+
+	tlv_values_t *m4 = tlv_new();
+	if (ok) {
+		request = tlv_new();
+		tlv_add_integer_value(request, TLVType_State, 1, 3);
+		tlv_add_value(request, TLVType_PublicKey, public_key, public_key_size);
+		tlv_add_value(request, TLVType_Proof, proof, proof_size);
+		std::string server_proof;
+		ok = loopback_tlv_request("/pair-setup", request, m4)
+				&& tlv_get_integer_value(m4, TLVType_State, 0) == 4
+				&& !(server_proof = loopback_tlv_value(m4, TLVType_Proof)).empty()
+				&& !loopback_srp_verify((const byte*) server_proof.data(), server_proof.size());
+	}
+	tlv_free(m4);
+	loopback_result("pair setup M1-M4", ok);
+
+	// M5: the long-term key of the controller, signed
+	byte session_key[32], device_x[32];
+	ok = ok && !loopback_srp_hkdf("Pair-Setup-Encrypt-Salt", "Pair-Setup-Encrypt-Info", session_key)
+			&& !loopback_srp_hkdf("Pair-Setup-Controller-Sign-Salt",
+					"Pair-Setup-Controller-Sign-Info", device_x);
+
+	controller_key = crypto_ed25519_new();
+	size_t controller_public_key_size = sizeof(controller_public_key);
+	ok = ok && !crypto_ed25519_generate(controller_key)
+			&& !crypto_ed25519_export_public_key(controller_key, controller_public_key,
+					&controller_public_key_size);
+
+	std::string device_info = std::string((const char*) device_x, 32) + loopback_pairing_id
+			+ std::string((const char*) controller_public_key, 32);
+	byte signature[64];
+	size_t signature_size = sizeof(signature);
+	ok = ok && !crypto_ed25519_sign(controller_key, (const byte*) device_info.data(),
+			device_info.size(), signature, &signature_size);
+
+	tlv_values_t *m6 = tlv_new();
+	tlv_values_t *m6_data = tlv_new();
+	if (ok) {
+		tlv_values_t *sub = tlv_new();
+		tlv_add_string_value(sub, TLVType_Identifier, loopback_pairing_id);
+		tlv_add_value(sub, TLVType_PublicKey, controller_public_key, 32);
+		tlv_add_value(sub, TLVType_Signature, signature, signature_size);
+		std::string encrypted_data = loopback_encrypt(session_key, "PS-Msg05", sub);
+
+		request = tlv_new();
+		tlv_add_integer_value(request, TLVType_State, 1, 5);
+		tlv_add_value(request, TLVType_EncryptedData, (const byte*) encrypted_data.data(),
+				encrypted_data.size());
+		ok = loopback_tlv_request("/pair-setup", request, m6)
+				&& tlv_get_integer_value(m6, TLVType_State, 0) == 6
+				&& loopback_decrypt(session_key, "PS-Msg06",
+						loopback_tlv_value(m6, TLVType_EncryptedData), m6_data);
+	}
+
+	// M6: the long-term key of the accessory, signed
+	byte accessory_x[32];
+	std::string accessory_public_key = loopback_tlv_value(m6_data, TLVType_PublicKey);
+	std::string accessory_signature = loopback_tlv_value(m6_data, TLVType_Signature);
+	accessory_id = loopback_tlv_value(m6_data, TLVType_Identifier);
+	tlv_free(m6_data);
+	tlv_free(m6);
+	ok = ok && !loopback_srp_hkdf("Pair-Setup-Accessory-Sign-Salt",
+			"Pair-Setup-Accessory-Sign-Info", accessory_x)
+			&& !crypto_ed25519_init(&accessory_key)
+			&& !crypto_ed25519_import_public_key(&accessory_key,
+					(const byte*) accessory_public_key.data(), accessory_public_key.size());
+	std::string accessory_info = std::string((const char*) accessory_x, 32) + accessory_id
+			+ accessory_public_key;
+	ok = ok && !crypto_ed25519_verify(&accessory_key, (const byte*) accessory_info.data(),
+			accessory_info.size(), (const byte*) accessory_signature.data(),
+			accessory_signature.size());
+	loopback_result("pair setup M5-M6", ok);
+
+	loopback_srp_free();
+	return ok;
+}
+
+static bool loopback_pair_verify() {
+	curve25519_key my_key, accessory_session_key;
+	byte my_public_key[32];
+	size_t my_public_key_size = sizeof(my_public_key);
+	bool ok = !crypto_curve25519_init(&my_key) && !crypto_curve25519_generate(&my_key)
+			&& !crypto_curve25519_export_public(&my_key, my_public_key, &my_public_key_size);
+
+	// M1-M2: the session keys, and the accessory signature of them
+	tlv_values_t *request = tlv_new();
+	tlv_add_integer_value(request, TLVType_State, 1, 1);
+	tlv_add_value(request, TLVType_PublicKey, my_public_key, my_public_key_size);
+	tlv_values_t *m2 = tlv_new();
+	ok = ok && loopback_tlv_request("/pair-verify", request, m2)
+			&& tlv_get_integer_value(m2, TLVType_State, 0) == 2;
+
+	std::string accessory_public_key = loopback_tlv_value(m2, TLVType_PublicKey);
+	byte shared_secret[32], session_key[32];
+	size_t shared_secret_size = sizeof(shared_secret);
+	ok = ok && !crypto_curve25519_init(&accessory_session_key)
+			&& !crypto_curve25519_import_public(&accessory_session_key,
+					(const byte*) accessory_public_key.data(), accessory_public_key.size())
+			&& !crypto_curve25519_shared_secret(&my_key, &accessory_session_key, shared_secret,
+					&shared_secret_size)
+			&& loopback_hkdf(shared_secret, shared_secret_size, "Pair-Verify-Encrypt-Salt",
+					"Pair-Verify-Encrypt-Info", session_key);
+
+	tlv_values_t *m2_data = tlv_new();
+	ok = ok && loopback_decrypt(session_key, "PV-Msg02",
+			loopback_tlv_value(m2, TLVType_EncryptedData), m2_data)
+			&& loopback_tlv_value(m2_data, TLVType_Identifier) == accessory_id;
+	std::string accessory_info = accessory_public_key + accessory_id
+			+ std::string((const char*) my_public_key, my_public_key_size);
+	std::string accessory_signature = loopback_tlv_value(m2_data, TLVType_Signature);
+	ok = ok && !crypto_ed25519_verify(&accessory_key, (const byte*) accessory_info.data(),
+			accessory_info.size(), (const byte*) accessory_signature.data(),
+			accessory_signature.size());
+	tlv_free(m2_data);
+	tlv_free(m2);
+
+	// M3-M4: the controller signature of them
+	std::string device_info = std::string((const char*) my_public_key, my_public_key_size)
+			+ loopback_pairing_id + accessory_public_key;
+	byte signature[64];
+	size_t signature_size = sizeof(signature);
+	ok = ok && !crypto_ed25519_sign(controller_key, (const byte*) device_info.data(),
+			device_info.size(), signature, &signature_size);
+
+	tlv_values_t *m4 = tlv_new();
+	if (ok) {
+		tlv_values_t *sub = tlv_new();
+		tlv_add_string_value(sub, TLVType_Identifier, loopback_pairing_id);
+		tlv_add_value(sub, TLVType_Signature, signature, signature_size);
+		std::string encrypted_data = loopback_encrypt(session_key, "PV-Msg03", sub);
+
+		request = tlv_new();
+		tlv_add_integer_value(request, TLVType_State, 1, 3);
+		tlv_add_value(request, TLVType_EncryptedData, (const byte*) encrypted_data.data(),
+				encrypted_data.size());
+		ok = loopback_tlv_request("/pair-verify", request, m4)
+				&& tlv_get_integer_value(m4, TLVType_State, 0) == 4;
+	}
+	tlv_free(m4);
+
+	ok = ok && loopback_hkdf(shared_secret, shared_secret_size, "Control-Salt",
+			"Control-Read-Encryption-Key", read_key)
+			&& loopback_hkdf(shared_secret, shared_secret_size, "Control-Salt",
+					"Control-Write-Encryption-Key", write_key);
+	crypto_curve25519_done(&my_key);
+	crypto_curve25519_done(&accessory_session_key);
+	loopback_result("pair verify", ok);
+
+	encrypted = ok;
+	return ok;
+}
+
+static std::string loopback_switch_json(const char *member) {
+	char json[128];
+	snprintf(json, sizeof(json), "{\"characteristics\":[{\"aid\":%u,\"iid\":%u,%s}]}",
+			(unsigned) loopback_switch_on.service->accessory->id, (unsigned) loopback_switch_on.id,
+			member);
+	return json;
+}
+
+int main() {
+	// A new accessory, not paired yet
+	unlink("homekit_flash.bin");
+
+	arduino_homekit_setup(&loopback_config);
+	if (!loopback_connect())
+		return 1;
+
+	if (!loopback_pair_setup() || !loopback_pair_verify())
+		return 1;
+
+	loopback_response_t response;
+	loopback_request("GET", "/accessories", "application/hap+json", "");
+	loopback_serve(100);
+	bool ok = loopback_response(&response) && response.status == 200;
+	ok = ok && response.body.find("\"Switch 9\"") != std::string::npos;
+	printf("loopback: GET /accessories, %u bytes, output queue of %u bytes\n",
+			(unsigned) response.body.size(), (unsigned) output_peak);
+	// Written in parts as the controller reads, not queued as a whole
+	ok = ok && output_peak < response.body.size() / 2;
+	loopback_result("accessories", ok);
+
+	loopback_request("PUT", "/characteristics", "application/hap+json",
+			"{\"characteristics\" [{\"aid\" 1 \"iid\" 9 \"value\" true}]}");
+	loopback_result("malformed json", loopback_response(&response) && response.status == 400);
+
+	loopback_request("PUT", "/characteristics", "application/hap+json",
+			loopback_switch_json("\"ev\":true"));
+	loopback_result("subscribe", loopback_response(&response) && response.status == 204);
+
+	homekit_update_config_number();
+	const char *config_number = MDNS.txt("c#");
+	loopback_result("config number", config_number && !strcmp(config_number, "2"));
+
+	loopback_switch_notify(true);
+	ok = loopback_response(&response) && response.event
+			&& response.body.find("\"value\":true") != std::string::npos;
+	loopback_result("event after the config number changed", ok);
+
+	// The EVENT waits for the end of the response being written
+	loopback_request("GET", "/accessories", "application/hap+json", "");
+	loopback_serve(10);
+	loopback_switch_notify(false);
+	loopback_serve(100);
+	ok = loopback_response(&response) && response.status == 200
+			&& response.body.find("\"Switch 9\"") != std::string::npos;
+	ok = ok && loopback_response(&response) && response.event
+			&& response.body.find("\"value\":false") != std::string::npos;
+	loopback_result("event during GET /accessories", ok);
+
+	int writes = loopback_switch_writes;
+	loopback_request("PUT", "/characteristics", "application/hap+json",
+			loopback_switch_json("\"value\":false"));
+	ok = loopback_response(&response) && response.status == 204
+			&& loopback_switch_writes == writes + 1;
+	loopback_result("write", ok);
+
+	// Nothing is applied from a request that turns out malformed after a valid write
+	writes = loopback_switch_writes;
+	std::string body = loopback_switch_json("\"value\":true");
+	body.insert(body.size() - 2, ",{\"aid\" 1}");
+	loopback_request("PUT", "/characteristics", "application/hap+json", body);
+	ok = loopback_response(&response) && response.status == 400
+			&& loopback_switch_writes == writes;
+	loopback_result("malformed json after a write", ok);
+
+	loopback_request("PUT", "/characteristics", "application/hap+json",
+			"{\"characteristics\":[{\"aid\":1,\"iid\":4294967305,\"value\":true}]}");
+	ok = loopback_response(&response) && response.status == 207
+			&& loopback_switch_writes == writes;
+	loopback_result("iid out of range", ok);
+
+	close(controller);
+	printf("loopback: %s\n", failures ? "FAILED" : "all ok");
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,79 @@
+/*
+ * loopback_accessory.c
+ *
+ * The accessories served by the loopback test: a switch, and enough bridged
+ * switches that GET /accessories is larger than the TCP send buffer and the
+ * initial output queue together (see HOMEKIT_OUTPUT_BUFFER_SIZE).
+ */
+
+#include <homekit/homekit.h>
+#include <homekit/characteristics.h>
+
+int loopback_switch_writes = 0;
+
+static void loopback_switch_setter(homekit_value_t value) {
+	(void) value;
+	loopback_switch_writes++;
+}
+
+homekit_characteristic_t loopback_switch_on = HOMEKIT_CHARACTERISTIC_(ON, false,
+		.setter = loopback_switch_setter);
+
+void loopback_switch_notify(bool on) {
+	loopback_switch_on.value = HOMEKIT_BOOL(on);
+	homekit_characteristic_notify(&loopback_switch_on, loopback_switch_on.value);
+}
+
+#define LOOPBACK_BRIDGED_SWITCH(_id, _name) \
+	HOMEKIT_ACCESSORY(.id=_id, .services=(homekit_service_t*[]) { \
+		HOMEKIT_SERVICE(ACCESSORY_INFORMATION, .characteristics=(homekit_characteristic_t*[]) { \
+			HOMEKIT_CHARACTERISTIC(NAME, _name), \
+			HOMEKIT_CHARACTERISTIC(MANUFACTURER, "Arduino HomeKit"), \
+			HOMEKIT_CHARACTERISTIC(SERIAL_NUMBER, "0123456"), \
+			HOMEKIT_CHARACTERISTIC(MODEL, "Host"), \
+			HOMEKIT_CHARACTERISTIC(FIRMWARE_REVISION, "1.0"), \
+			HOMEKIT_CHARACTERISTIC(IDENTIFY, NULL), \
+			NULL \
+		}), \
+		HOMEKIT_SERVICE(SWITCH, .primary=true, .characteristics=(homekit_characteristic_t*[]) { \
+			HOMEKIT_CHARACTERISTIC(ON, false), \
+			HOMEKIT_CHARACTERISTIC(NAME, _name), \
+			NULL \
+		}), \
+		NULL \
+	})
+
+homekit_accessory_t *loopback_accessories[] = {
+	HOMEKIT_ACCESSORY(.id=1, .services=(homekit_service_t*[]) {
+		HOMEKIT_SERVICE(ACCESSORY_INFORMATION, .characteristics=(homekit_characteristic_t*[]) {
+			HOMEKIT_CHARACTERISTIC(NAME, "Loopback"),
+			HOMEKIT_CHARACTERISTIC(MANUFACTURER, "Arduino HomeKit"),
+			HOMEKIT_CHARACTERISTIC(SERIAL_NUMBER, "0123456"),
+			HOMEKIT_CHARACTERISTIC(MODEL, "Host"),
+			HOMEKIT_CHARACTERISTIC(FIRMWARE_REVISION, "1.0"),
+			HOMEKIT_CHARACTERISTIC(IDENTIFY, NULL),
+			NULL
+		}),
+		HOMEKIT_SERVICE(SWITCH, .primary=true, .characteristics=(homekit_characteristic_t*[]) {
+			&loopback_switch_on,
+			HOMEKIT_CHARACTERISTIC(NAME, "Switch"),
+			NULL
+		}),
+		NULL
+	}),
+	LOOPBACK_BRIDGED_SWITCH(2, "Switch 2"),
+	LOOPBACK_BRIDGED_SWITCH(3, "Switch 3"),
+	LOOPBACK_BRIDGED_SWITCH(4, "Switch 4"),
+	LOOPBACK_BRIDGED_SWITCH(5, "Switch 5"),
+	LOOPBACK_BRIDGED_SWITCH(6, "Switch 6"),
+	LOOPBACK_BRIDGED_SWITCH(7, "Switch 7"),
+	LOOPBACK_BRIDGED_SWITCH(8, "Switch 8"),
+	LOOPBACK_BRIDGED_SWITCH(9, "Switch 9"),
+	NULL
+};
+
+homekit_server_config_t loopback_config = {
+	.accessories = loopback_accessories,
+	.category = homekit_accessory_category_bridge,
+	.password = "111-11-111"
+};
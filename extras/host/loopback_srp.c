@@ -0,0 +1,59 @@
+/*
+ * loopback_srp.c
+ *
+ * The controller side of the SRP exchange of Pair Setup, for loopback.cpp
+ * (wolfcrypt's Srp and crypto.h's Srp cannot be declared in the same unit).
+ */
+
+#include <string.h>
+#include <wolfssl/wolfcrypt/settings.h>
+#include <wolfssl/wolfcrypt/srp.h>
+#include <esp_xpgm.h>
+
+// crypto.c
+extern const byte N[];
+int wc_SrpSetKeyH(Srp *srp, byte *secret, word32 size);
+int crypto_hkdf(const byte *key, size_t key_size, const byte *salt, size_t salt_size,
+		const byte *info, size_t info_size, byte *output, size_t *output_size);
+
+static Srp loopback_srp;
+
+// Computes the public key and the proof of the controller from the salt and the
+// public key of the accessory (M2)
+int loopback_srp_proof(const char *password, const byte *salt, size_t salt_size,
+		const byte *server_public_key, size_t server_public_key_size,
+		byte *public_key, size_t *public_key_size, byte *proof, size_t *proof_size) {
+	byte n[384], g = 5;
+	memcpy_P(n, N, sizeof(n));
+	word32 size = *public_key_size, proof_length = *proof_size;
+
+	int r = wc_SrpInit(&loopback_srp, SRP_TYPE_SHA512, SRP_CLIENT_SIDE);
+	loopback_srp.keyGenFunc_cb = wc_SrpSetKeyH;
+	if (!r) r = wc_SrpSetUsername(&loopback_srp, (const byte*) "Pair-Setup", 10);
+	if (!r) r = wc_SrpSetParams(&loopback_srp, n, sizeof(n), &g, 1, salt, salt_size);
+	if (!r) r = wc_SrpSetPassword(&loopback_srp, (const byte*) password, strlen(password));
+	if (!r) r = wc_SrpGetPublic(&loopback_srp, public_key, &size);
+	if (!r) r = wc_SrpComputeKey(&loopback_srp, public_key, size,
+			(byte*) server_public_key, server_public_key_size);
+	if (!r) r = wc_SrpGetProof(&loopback_srp, proof, &proof_length);
+
+	*public_key_size = size;
+	*proof_size = proof_length;
+	return r;
+}
+
+// Checks the proof of the accessory (M4)
+int loopback_srp_verify(const byte *proof, size_t proof_size) {
+	return wc_SrpVerifyPeersProof(&loopback_srp, (byte*) proof, proof_size);
+}
+
+// A key derived from the SRP session key (M5, M6)
+int loopback_srp_hkdf(const char *salt, const char *info, byte *output) {
+	size_t size = 32;
+	return crypto_hkdf(loopback_srp.key, loopback_srp.keySz, (const byte*) salt, strlen(salt),
+			(const byte*) info, strlen(info), output, &size);
+}
+
+void loopback_srp_free() {
+	wc_SrpTerm(&loopback_srp);
+}
@@ -0,0 +1,73 @@
+/*
+ * Arduino.h
+ *
+ * Host build (see ../Makefile): the few parts of the ESP8266 Arduino core
+ * used by arduino_homekit_server.cpp, over POSIX.
+ */
+
+#ifndef HOST_ARDUINO_H_
+#define HOST_ARDUINO_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <port.h>
+#include <esp_xpgm.h>
+
+typedef uint8_t byte;
+
+#ifdef __cplusplus
+
+#include <string>
+#include <functional>
+
+class String {
+public:
+	String(const char *s = "") : s(s ? s : "") {}
+	String(int x) : s(std::to_string(x)) {}
+	String(unsigned int x) : s(std::to_string(x)) {}
+	const char *c_str() const { return s.c_str(); }
+private:
+	std::string s;
+};
+
+class IPAddress {
+public:
+	IPAddress(uint32_t address = 0) : address(address) {}
+	IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d)
+			: address(a | (b << 8) | (c << 16) | ((uint32_t) d << 24)) {}
+	bool isSet() const { return address != 0; }
+	operator uint32_t() const { return address; }
+	String toString() const;
+private:
+	uint32_t address; // network order, as in lwIP
+};
+
+class EspClass {
+public:
+	String getResetReason() { return String("External System"); }
+	uint32_t getFreeHeap() { return system_get_free_heap_size(); }
+	uint8_t getCpuFreqMHz() { return 160; }
+};
+
+extern EspClass ESP;
+
+void delay(unsigned long ms);
+
+extern "C" {
+#endif
+
+#define SYS_CPU_80MHZ 80
+#define SYS_CPU_160MHZ 160
+
+void system_restart();
+uint8_t system_get_cpu_freq();
+bool system_update_cpu_freq(uint8_t freq);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_ARDUINO_H_ */
@@ -0,0 +1,36 @@
+/*
+ * ESP8266WiFi.h
+ *
+ * Host build: the station is always connected, at 127.0.0.1.
+ */
+
+#ifndef HOST_ESP8266WIFI_H_
+#define HOST_ESP8266WIFI_H_
+
+#include <memory>
+#include <functional>
+#include "Arduino.h"
+#include "WiFiServer.h"
+
+struct WiFiEventStationModeGotIP {
+	IPAddress ip;
+	IPAddress mask;
+	IPAddress gw;
+};
+
+typedef std::shared_ptr<std::function<void(const WiFiEventStationModeGotIP&)>> WiFiEventHandler;
+
+class ESP8266WiFiClass {
+public:
+	bool isConnected() { return true; }
+	IPAddress localIP() { return IPAddress(127, 0, 0, 1); }
+	bool hostname(const char * /*name*/) { return true; }
+	// Never called back: the station does not reconnect
+	WiFiEventHandler onStationModeGotIP(std::function<void(const WiFiEventStationModeGotIP&)> f) {
+		return std::make_shared<std::function<void(const WiFiEventStationModeGotIP&)>>(f);
+	}
+};
+
+extern ESP8266WiFiClass WiFi;
+
+#endif /* HOST_ESP8266WIFI_H_ */
@@ -0,0 +1,46 @@
+/*
+ * ESP8266mDNS.h
+ *
+ * Host build: an mDNS responder which announces nothing. The TXT items of the
+ * service are kept, see MDNSResponder::txt, so that a test can read "c#" or "sf".
+ */
+
+#ifndef HOST_ESP8266MDNS_H_
+#define HOST_ESP8266MDNS_H_
+
+#include <functional>
+#include <map>
+#include <string>
+#include "Arduino.h"
+
+class MDNSResponder {
+public:
+	typedef const void *hMDNSService;
+	typedef const void *hMDNSTxt;
+	typedef std::function<void(const hMDNSService)> MDNSDynamicServiceTxtCallbackFunc;
+
+	bool begin(const char *hostname, const IPAddress &ip);
+	bool close();
+	bool announce();
+	bool update() { return true; }
+
+	hMDNSService addService(const char *name, const char *service, const char *protocol,
+			uint16_t port);
+	hMDNSTxt addServiceTxt(hMDNSService service, const char *key, const char *value);
+	hMDNSTxt addDynamicServiceTxt(hMDNSService service, const char *key, const char *value);
+	hMDNSTxt addDynamicServiceTxt(hMDNSService service, const char *key, uint32_t value);
+	bool setDynamicServiceTxtCallback(hMDNSService service,
+			MDNSDynamicServiceTxtCallbackFunc callback);
+
+	// The TXT item of the service, the dynamic ones as of the last announce.
+	// NULL if there is none.
+	const char *txt(const char *key);
+
+private:
+	std::map<std::string, std::string> items;
+	MDNSDynamicServiceTxtCallbackFunc callback;
+};
+
+extern MDNSResponder MDNS;
+
+#endif /* HOST_ESP8266MDNS_H_ */
@@ -0,0 +1,7 @@
+/*
+ * LEAmDNS.h
+ *
+ * Host build: see ESP8266mDNS.h
+ */
+
+#include "ESP8266mDNS.h"
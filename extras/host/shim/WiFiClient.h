@@ -0,0 +1,50 @@
+/*
+ * WiFiClient.h
+ *
+ * Host build: a non-blocking TCP socket with the WiFiClient interface of the
+ * ESP8266 core. The copies share the socket, as they share the lwIP
+ * ClientContext on the device.
+ */
+
+#ifndef HOST_WIFICLIENT_H_
+#define HOST_WIFICLIENT_H_
+
+#include <memory>
+#include "Arduino.h"
+
+// What availableForWrite reports at most, like TCP_SND_BUF (2 * TCP_MSS) of the
+// lwIP build of the ESP8266 core, so that the output queue is used as on the device
+#ifndef HOST_TCP_SND_BUF
+#define HOST_TCP_SND_BUF 2920
+#endif
+
+class WiFiClient {
+public:
+	WiFiClient();
+	explicit WiFiClient(int fd);
+
+	int available();
+	bool connected();
+	int read(uint8_t *buffer, size_t size);
+	size_t write(const uint8_t *data, size_t size);
+	size_t availableForWrite();
+	void flush();
+	void stop();
+
+	void keepAlive(uint16_t idle_sec, uint16_t interval_sec, uint8_t count);
+	void setNoDelay(bool nodelay);
+	void setSync(bool /*sync*/) {}
+	void setTimeout(unsigned long /*timeout*/) {}
+
+	IPAddress localIP();
+	uint16_t localPort();
+	IPAddress remoteIP();
+	uint16_t remotePort();
+
+private:
+	struct Socket;
+	std::shared_ptr<Socket> socket;
+	int fd() const;
+};
+
+#endif /* HOST_WIFICLIENT_H_ */
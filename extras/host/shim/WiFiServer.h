@@ -0,0 +1,31 @@
+/*
+ * WiFiServer.h
+ *
+ * Host build: a non-blocking listening socket on 127.0.0.1.
+ */
+
+#ifndef HOST_WIFISERVER_H_
+#define HOST_WIFISERVER_H_
+
+#include "WiFiClient.h"
+
+class WiFiServer {
+public:
+	WiFiServer(uint16_t port);
+	~WiFiServer();
+
+	void begin();
+	void setNoDelay(bool nodelay) { this->nodelay = nodelay; }
+	bool hasClient();
+	WiFiClient available();
+	void stop();
+	void close() { stop(); }
+
+private:
+	uint16_t port;
+	int fd = -1;
+	int pending = -1; // accepted by hasClient, returned by available
+	bool nodelay = false;
+};
+
+#endif /* HOST_WIFISERVER_H_ */
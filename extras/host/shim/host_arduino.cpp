@@ -0,0 +1,290 @@
+/*
+ * host_arduino.cpp
+ *
+ * Host build: the ESP8266 core functions and classes declared by the headers
+ * of this directory, over POSIX sockets.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <time.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#ifdef __linux__
+#include <linux/sockios.h>
+#endif
+
+#include "Arduino.h"
+#include "ESP8266WiFi.h"
+#include "ESP8266mDNS.h"
+
+EspClass ESP;
+ESP8266WiFiClass WiFi;
+MDNSResponder MDNS;
+
+void delay(unsigned long ms) {
+	struct timespec ts = { (time_t) (ms / 1000), (long) (ms % 1000) * 1000000 };
+	nanosleep(&ts, NULL);
+}
+
+void system_restart() {
+	homekit_system_restart();
+}
+
+static uint8_t host_cpu_freq = SYS_CPU_80MHZ;
+
+uint8_t system_get_cpu_freq() {
+	return host_cpu_freq;
+}
+
+bool system_update_cpu_freq(uint8_t freq) {
+	host_cpu_freq = freq;
+	return true;
+}
+
+String IPAddress::toString() const {
+	char buffer[16];
+	snprintf(buffer, sizeof(buffer), "%u.%u.%u.%u", address & 0xFF, (address >> 8) & 0xFF,
+			(address >> 16) & 0xFF, address >> 24);
+	return String(buffer);
+}
+
+//=====================
+// WiFiClient
+//=====================
+
+struct WiFiClient::Socket {
+	int fd;
+	Socket(int fd) : fd(fd) {}
+	~Socket() {
+		if (fd >= 0)
+			::close(fd);
+	}
+};
+
+WiFiClient::WiFiClient() {
+}
+
+WiFiClient::WiFiClient(int fd) : socket(std::make_shared<Socket>(fd)) {
+	fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+}
+
+int WiFiClient::fd() const {
+	return socket ? socket->fd : -1;
+}
+
+int WiFiClient::available() {
+	int size = 0;
+	if (fd() < 0 || ioctl(fd(), FIONREAD, &size) < 0)
+		return 0;
+	return size;
+}
+
+bool WiFiClient::connected() {
+	if (fd() < 0)
+		return false;
+	// Like the ESP8266 core: still connected while there is data to read
+	uint8_t c;
+	ssize_t r = recv(fd(), &c, 1, MSG_PEEK | MSG_DONTWAIT);
+	return r > 0 || (r < 0 && (errno == EAGAIN || errno == EWOULDBLOCK));
+}
+
+int WiFiClient::read(uint8_t *buffer, size_t size) {
+	if (fd() < 0)
+		return -1;
+	ssize_t r = recv(fd(), buffer, size, MSG_DONTWAIT);
+	return r < 0 ? -1 : (int) r;
+}
+
+size_t WiFiClient::write(const uint8_t *data, size_t size) {
+	if (fd() < 0)
+		return 0;
+	ssize_t r = send(fd(), data, size, MSG_DONTWAIT | MSG_NOSIGNAL);
+	return r < 0 ? 0 : (size_t) r;
+}
+
+// HOST_TCP_SND_BUF less the bytes not ACKed yet
+size_t WiFiClient::availableForWrite() {
+	if (fd() < 0)
+		return 0;
+	int queued = 0;
+#ifdef SIOCOUTQ
+	if (ioctl(fd(), SIOCOUTQ, &queued) < 0)
+		return 0;
+#endif
+	return queued < HOST_TCP_SND_BUF ? HOST_TCP_SND_BUF - queued : 0;
+}
+
+void WiFiClient::flush() {
+}
+
+void WiFiClient::stop() {
+	if (socket && socket->fd >= 0) {
+		::close(socket->fd);
+		socket->fd = -1;
+	}
+}
+
+// The idle time, interval and count are left to the system defaults
+void WiFiClient::keepAlive(uint16_t /*idle_sec*/, uint16_t /*interval_sec*/, uint8_t /*count*/) {
+	int on = 1;
+	setsockopt(fd(), SOL_SOCKET, SO_KEEPALIVE, &on, sizeof(on));
+}
+
+void WiFiClient::setNoDelay(bool nodelay) {
+	int on = nodelay;
+	setsockopt(fd(), IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+}
+
+static IPAddress host_address(int fd, bool peer, uint16_t *port) {
+	struct sockaddr_in address;
+	socklen_t size = sizeof(address);
+	memset(&address, 0, sizeof(address));
+	if (peer)
+		getpeername(fd, (struct sockaddr*) &address, &size);
+	else
+		getsockname(fd, (struct sockaddr*) &address, &size);
+	if (port)
+		*port = ntohs(address.sin_port);
+	return IPAddress(address.sin_addr.s_addr);
+}
+
+IPAddress WiFiClient::localIP() {
+	return host_address(fd(), false, NULL);
+}
+
+uint16_t WiFiClient::localPort() {
+	uint16_t port = 0;
+	host_address(fd(), false, &port);
+	return port;
+}
+
+IPAddress WiFiClient::remoteIP() {
+	return host_address(fd(), true, NULL);
+}
+
+uint16_t WiFiClient::remotePort() {
+	uint16_t port = 0;
+	host_address(fd(), true, &port);
+	return port;
+}
+
+//=====================
+// WiFiServer
+//=====================
+
+WiFiServer::WiFiServer(uint16_t port) : port(port) {
+}
+
+WiFiServer::~WiFiServer() {
+	stop();
+}
+
+void WiFiServer::begin() {
+	fd = ::socket(AF_INET, SOCK_STREAM, 0);
+	if (fd < 0)
+		return;
+
+	int on = 1;
+	setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+
+	struct sockaddr_in address;
+	memset(&address, 0, sizeof(address));
+	address.sin_family = AF_INET;
+	address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	address.sin_port = htons(port);
+	if (bind(fd, (struct sockaddr*) &address, sizeof(address)) < 0 || listen(fd, 4) < 0) {
+		perror("WiFiServer::begin");
+		::close(fd);
+		fd = -1;
+		return;
+	}
+	fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+}
+
+bool WiFiServer::hasClient() {
+	if (pending < 0 && fd >= 0)
+		pending = accept(fd, NULL, NULL);
+	return pending >= 0;
+}
+
+WiFiClient WiFiServer::available() {
+	if (!hasClient())
+		return WiFiClient();
+
+	WiFiClient client(pending);
+	pending = -1;
+	client.setNoDelay(nodelay);
+	return client;
+}
+
+void WiFiServer::stop() {
+	if (pending >= 0) {
+		::close(pending);
+		pending = -1;
+	}
+	if (fd >= 0) {
+		::close(fd);
+		fd = -1;
+	}
+}
+
+//=====================
+// MDNSResponder
+//=====================
+
+bool MDNSResponder::begin(const char * /*hostname*/, const IPAddress & /*ip*/) {
+	items.clear();
+	return true;
+}
+
+bool MDNSResponder::close() {
+	items.clear();
+	callback = nullptr;
+	return true;
+}
+
+bool MDNSResponder::announce() {
+	if (callback)
+		callback(this);
+	return true;
+}
+
+MDNSResponder::hMDNSService MDNSResponder::addService(const char * /*name*/,
+		const char * /*service*/, const char * /*protocol*/, uint16_t /*port*/) {
+	return this;
+}
+
+MDNSResponder::hMDNSTxt MDNSResponder::addServiceTxt(hMDNSService /*service*/, const char *key,
+		const char *value) {
+	items[key] = value;
+	return this;
+}
+
+MDNSResponder::hMDNSTxt MDNSResponder::addDynamicServiceTxt(hMDNSService /*service*/,
+		const char *key, const char *value) {
+	items[key] = value;
+	return this;
+}
+
+MDNSResponder::hMDNSTxt MDNSResponder::addDynamicServiceTxt(hMDNSService /*service*/,
+		const char *key, uint32_t value) {
+	items[key] = std::to_string(value);
+	return this;
+}
+
+bool MDNSResponder::setDynamicServiceTxtCallback(hMDNSService /*service*/,
+		MDNSDynamicServiceTxtCallbackFunc callback) {
+	this->callback = callback;
+	return true;
+}
+
+const char *MDNSResponder::txt(const char *key) {
+	auto it = items.find(key);
+	return it == items.end() ? NULL : it->second.c_str();
+}
@@ -394,9 +394,104 @@ void homekit_characteristic_ex_old_setter(homekit_characteristic_t *ch, homekit_
     ch->setter(value);
 }
 
+// Direct (aid, iid) index of the initialized accessories, used by
+// homekit_characteristic_by_aid_and_iid. The slots of accessory aid are
+// characteristic_index[characteristic_index_offsets[aid] + iid] (NULL for a service iid),
+// up to characteristic_index_offsets[aid + 1].
+// The ids are assigned in sequence by homekit_accessories_init, so the table is dense;
+// it is not built when the ids are too sparse (then the linear scan is used).
+static homekit_accessory_t **characteristic_index_accessories = NULL;
+static homekit_characteristic_t **characteristic_index = NULL;
+static uint16_t *characteristic_index_offsets = NULL;
+static uint32_t characteristic_index_max_aid = 0;
+
+static void characteristic_index_build(homekit_accessory_t **accessories) {
+    if (characteristic_index) {
+        free(characteristic_index);
+        characteristic_index = NULL;
+    }
+    if (characteristic_index_offsets) {
+        free(characteristic_index_offsets);
+        characteristic_index_offsets = NULL;
+    }
+    characteristic_index_accessories = NULL;
+    characteristic_index_max_aid = 0;
+
+    uint32_t max_aid = 0;
+    size_t count = 0;
+    for (homekit_accessory_t **accessory_it = accessories; *accessory_it; accessory_it++) {
+        if ((*accessory_it)->id > max_aid)
+            max_aid = (*accessory_it)->id;
+        for (homekit_service_t **service_it = (*accessory_it)->services; *service_it; service_it++) {
+            count++;
+            for (homekit_characteristic_t **ch_it = (*service_it)->characteristics; *ch_it; ch_it++) {
+                count++;
+            }
+        }
+    }
+    if (!max_aid || max_aid > 2 * count)
+        return;
+
+    uint16_t *offsets = calloc(max_aid + 2, sizeof(uint16_t));
+    if (!offsets)
+        return;
+
+    // Slots needed by each accessory: its max iid + 1
+    for (homekit_accessory_t **accessory_it = accessories; *accessory_it; accessory_it++) {
+        uint32_t max_iid = 0;
+        for (homekit_service_t **service_it = (*accessory_it)->services; *service_it; service_it++) {
+            if ((*service_it)->id > max_iid)
+                max_iid = (*service_it)->id;
+            for (homekit_characteristic_t **ch_it = (*service_it)->characteristics; *ch_it; ch_it++) {
+                if ((*ch_it)->id > max_iid)
+                    max_iid = (*ch_it)->id;
+            }
+        }
+        if (max_iid >= 0xFFFF) {
+            // Does not fit the 16-bit offsets, keep the linear scan
+            free(offsets);
+            return;
+        }
+        if (max_iid + 1 > offsets[(*accessory_it)->id + 1])
+            offsets[(*accessory_it)->id + 1] = max_iid + 1;
+    }
+
+    size_t slots = 0;
+    for (uint32_t aid = 1; aid <= max_aid + 1; aid++) {
+        slots += offsets[aid];
+        if (slots > 2 * count || slots > 0xFFFF) {
+            free(offsets);
+            return;
+        }
+        offsets[aid] = slots;
+    }
+
+    homekit_characteristic_t **index = calloc(slots, sizeof(homekit_characteristic_t *));
+    if (!index) {
+        free(offsets);
+        return; // homekit_characteristic_by_aid_and_iid falls back to the linear scan
+    }
+
+    for (homekit_accessory_t **accessory_it = accessories; *accessory_it; accessory_it++) {
+        uint16_t offset = offsets[(*accessory_it)->id];
+        for (homekit_service_t **service_it = (*accessory_it)->services; *service_it; service_it++) {
+            for (homekit_characteristic_t **ch_it = (*service_it)->characteristics; *ch_it; ch_it++) {
+                if (!index[offset + (*ch_it)->id])
+                    index[offset + (*ch_it)->id] = *ch_it;
+            }
+        }
+    }
+
+    characteristic_index = index;
+    characteristic_index_offsets = offsets;
+    characteristic_index_max_aid = max_aid;
+    characteristic_index_accessories = accessories;
+}
+
 void homekit_accessories_init(homekit_accessory_t **accessories) {
     //设置aid 和 iid (自增1)
 	uint32_t aid = 1;
+    uint16_t slot = 0;
     for (homekit_accessory_t **accessory_it = accessories; *accessory_it; accessory_it++) {
     	homekit_accessory_t *accessory = *accessory_it;
         if (accessory->id) {
@@ -424,6 +519,7 @@ void homekit_accessories_init(homekit_accessory_t **accessories) {
                 } else {
                     ch->id = iid++;
                 }
+                ch->slot = slot++;
 
                 if (!ch->getter_ex && ch->getter) {
                     ch->getter_ex = homekit_characteristic_ex_old_getter;
@@ -437,6 +533,8 @@ void homekit_accessories_init(homekit_accessory_t **accessories) {
             }
         }
     }
+
+    characteristic_index_build(accessories);
 }
 
 homekit_accessory_t *homekit_accessory_by_id(homekit_accessory_t **accessories, uint32_t aid) {
@@ -473,6 +571,17 @@ homekit_characteristic_t *homekit_service_characteristic_by_type(homekit_service
 }
 
 homekit_characteristic_t *homekit_characteristic_by_aid_and_iid(homekit_accessory_t **accessories, uint32_t aid, uint32_t iid) {
+    if (accessories == characteristic_index_accessories) {
+        if (!aid || aid > characteristic_index_max_aid)
+            return NULL;
+
+        uint32_t offset = characteristic_index_offsets[aid];
+        if (iid >= characteristic_index_offsets[aid + 1] - offset)
+            return NULL;
+
+        return characteristic_index[offset + iid];
+    }
+
     for (homekit_accessory_t **accessory_it = accessories; *accessory_it; accessory_it++) {
         homekit_accessory_t *accessory = *accessory_it;
 
@@ -23,17 +23,15 @@
 #include "port.h"
 #include "http_parser.h"
 #include "query_params.h"
-#include "cJSON.h"
-#include "cQueue.h"
+#include "json_parser.h"
 #include "crypto.h"
 #include "watchdog.h"
 #include "arduino_homekit_server.h"
 
 #define HOMEKIT_SERVER_PORT      5556
-#define HOMEKIT_MAX_CLIENTS      8
+#define HOMEKIT_MAX_CLIENTS      8 // at most 8, see homekit_server_t.subscribers
 #define HOMEKIT_MDNS_SERVICE     "hap"//"_hap"
 #define HOMEKIT_MDNS_PROTO       "tcp"//"_tcp"
-#define HOMEKIT_EVENT_QUEUE_SIZE 4 //original is 20
 #define HOMEKIT_SOCKET_TIMEOUT   500 //milliseconds
 
 //#define TCP_DEFAULT_KEEPALIVE_IDLE_SEC          7200 // 2 hours
@@ -47,20 +45,87 @@
 #define HOMEKIT_SOCKET_KEEPALIVE_IDLE_COUNT     4
 // if 180 + 30 * 4 = 300 sec without socket response, disconected it.
 
+// Requests with a larger body are rejected, HAP bodies are at most a few KB
+#ifndef HOMEKIT_MAX_BODY_SIZE
+#define HOMEKIT_MAX_BODY_SIZE  (16 * 1024)
+#endif
+
 // WiFiClient can not write big buff once.
 // TCP_SND_BUF = (2 * TCP_MSS) = 1072. See lwipopts.h
-// max(encrypted_chunk) = 512 + 8(chunk_info) + 18(chacha_info). See client_send_encrypted
+// max(encrypted_chunk) = 512 + 8(chunk_info) + 18(chacha_info). See client_send_chunk
 #define HOMEKIT_JSONBUFFER_SIZE  512
 
+// 1: pack the HTTP headers, the json chunks and the last 0-chunk of a response
+//    into full HAP frames (HOMEKIT_FRAME_SIZE), less Poly1305 tags and TCP segments.
+// 0: one HAP frame (and one socket write) per json chunk.
+#ifndef HOMEKIT_COALESCE_FRAMES
+#define HOMEKIT_COALESCE_FRAMES  1
+#endif
+
+// 1: keep the rendered /accessories json in RAM (rebuilt after homekit_update_config_number),
+//    only "ev" and "value" are written for each request. Costs RAM of the size of the json.
+// 0: render the full json on each request.
+#ifndef HOMEKIT_ACCESSORIES_CACHE
+#define HOMEKIT_ACCESSORIES_CACHE  1
+#endif
+
+// The output a slow controller does not take yet (the TCP send buffer is full until
+// it ACKs) is queued per client and sent from arduino_homekit_loop, instead of blocking
+// the loop in WiFiClient::write. The queue starts at HOMEKIT_OUTPUT_BUFFER_SIZE and
+// doubles up to HOMEKIT_OUTPUT_BUFFER_MAX_SIZE, the queues of all the clients together
+// take at most HOMEKIT_OUTPUT_BUDGET. A response which does not fit closes the client.
+#ifndef HOMEKIT_OUTPUT_BUFFER_SIZE
+#define HOMEKIT_OUTPUT_BUFFER_SIZE  4096
+#endif
+
+#ifndef HOMEKIT_OUTPUT_BUFFER_MAX_SIZE
+#define HOMEKIT_OUTPUT_BUFFER_MAX_SIZE  8192
+#endif
+
+#ifndef HOMEKIT_OUTPUT_BUDGET
+#define HOMEKIT_OUTPUT_BUDGET  16384
+#endif
+
+// GET /accessories, the largest response, is written in parts while less than this
+// is queued for the client, and resumed by homekit_client_process once the queue
+// drained below it. The EVENT messages for the client wait meanwhile.
+#ifndef HOMEKIT_OUTPUT_RESUME_SIZE
+#define HOMEKIT_OUTPUT_RESUME_SIZE  1024
+#endif
+
+// 1: keep the SRP setup of the password (salt, verifier and the server key of the
+//    next pairing attempt) in flash, see homekit_storage_save_srp_setup, so that
+//    the preinit after a boot takes milliseconds instead of ~10s. Only with
+//    config->password, a random password is not kept. The server key is computed
+//    again by the preinit after a pairing attempt used it.
+// 0: compute it in each preinit.
+#ifndef HOMEKIT_SRP_CACHE
+#define HOMEKIT_SRP_CACHE  0
+#endif
+
+// The SRP computations of the preinit and of Pair Setup M3 are done in steps of this
+// many 3072-bit Montgomery multiplications, one step per arduino_homekit_loop, so that
+// the loop keeps serving the other clients and feeding the watchdog meanwhile. Higher
+// values pair sooner, lower values keep each arduino_homekit_loop shorter.
+#ifndef HOMEKIT_SRP_STEP_OPERATIONS
+#define HOMEKIT_SRP_STEP_OPERATIONS  4
+#endif
+
 #ifdef HOMEKIT_DEBUG
 #define TLV_DEBUG(values) //tlv_debug(values)
 #else
 #define TLV_DEBUG(values)
 #endif
 
-#define CLIENT_DEBUG(client, message, ...) DEBUG("[Client %d] " message, client->socket, ##__VA_ARGS__)
-#define CLIENT_INFO(client, message, ...) INFO("[Client %d] " message, client->socket, ##__VA_ARGS__)
-#define CLIENT_ERROR(client, message, ...) ERROR("[Client %d] " message, client->socket, ##__VA_ARGS__)
+#define CLIENT_DEBUG(client, message, ...) DEBUG("[Client %d] " message, (int) (intptr_t) client->socket, ##__VA_ARGS__)
+#define CLIENT_INFO(client, message, ...) INFO("[Client %d] " message, (int) (intptr_t) client->socket, ##__VA_ARGS__)
+#define CLIENT_ERROR(client, message, ...) ERROR("[Client %d] " message, (int) (intptr_t) client->socket, ##__VA_ARGS__)
+
+// Bitmaps by characteristic slot: client->events and the server->events_* ones
+#define BITMAP_WORDS(bits) (((bits) + 31) / 32)
+#define BITMAP_GET(bitmap, bit) ((bitmap)[(bit) / 32] & (1u << ((bit) % 32)))
+#define BITMAP_SET(bitmap, bit) ((bitmap)[(bit) / 32] |= (1u << ((bit) % 32)))
+#define BITMAP_CLEAR(bitmap, bit) ((bitmap)[(bit) / 32] &= ~(1u << ((bit) % 32)))
 
 client_context_t *current_client_context = NULL;
 homekit_server_t *running_server = nullptr;
@@ -74,6 +139,11 @@ void client_context_free(client_context_t *c);
 void pairing_context_free(pairing_context_t *context);
 void homekit_server_close_client(homekit_server_t *server, client_context_t *context);
 bool arduino_homekit_preinit(homekit_server_t *server);
+int pairing_context_srp_step(pairing_context_t *context);
+void accessories_cache_free(accessories_cache_t *cache);
+void server_characteristics_free(homekit_server_t *server);
+void server_notify_characteristic(homekit_characteristic_t *ch, homekit_value_t value,
+		void *context);
 
 homekit_server_t* server_new() {
 	homekit_server_t *server = (homekit_server_t*) malloc(sizeof(homekit_server_t));
@@ -88,6 +158,19 @@ homekit_server_t* server_new() {
 	server->paired = false;
 	server->pairing_context = NULL;
 	server->clients = NULL;
+	server->frame_size = 0;
+	server->frame_client = NULL;
+	server->accessories_cache = NULL;
+	server->output_total = 0;
+	server->characteristics = NULL;
+	server->characteristic_values = NULL;
+	server->characteristics_count = 0;
+	server->characteristic_sent_at = NULL;
+	server->events_ready = NULL;
+	server->events_sent = NULL;
+	server->events_message = NULL;
+	server->subscribers = NULL;
+	server->events_pending = false;
 	return server;
 }
 
@@ -109,6 +192,14 @@ void server_free(homekit_server_t *server) {
 		delete server->wifi_server;
 		server->wifi_server = nullptr;
 	}
+	if (server->accessories_cache) {
+		accessories_cache_free(server->accessories_cache);
+		server->accessories_cache = NULL;
+	}
+	if (server->config)
+		homekit_accessories_clear_notify_callbacks(server->config->accessories,
+				server_notify_characteristic, server);
+	server_characteristics_free(server);
 	DEBUG("homekit_server_t delete WiFiServer at port: %d\n", HOMEKIT_SERVER_PORT);
 
 	if (server == running_server) {
@@ -173,6 +264,7 @@ client_context_t* client_context_new(WiFiClient *wifiClient) {
 	c->body_length = 0;
 	http_parser_init(&c->parser, HTTP_REQUEST);
 	c->parser.data = c;
+	arena_init(&c->arena, c->arena_data, sizeof(c->arena_data));
 
 	c->pairing_id = -1;
 	c->encrypted = false;
@@ -180,10 +272,11 @@ client_context_t* client_context_new(WiFiClient *wifiClient) {
 	c->count_writes = 0;
 	c->disconnect = false;
 
-	//c->event_queue = xQueueCreate(20, sizeof(characteristic_event_t*));
-	c->event_queue = (Queue_t*) malloc(sizeof(Queue_t));
-	q_init(c->event_queue, sizeof(characteristic_event_t*),
-	HOMEKIT_EVENT_QUEUE_SIZE, LIFO, true);
+	c->index = 0;
+	c->subscriptions_count = 0;
+	c->events = NULL;
+	c->events_pending = false;
+	c->events_time = 0;
 
 	c->verify_context = NULL;
 
@@ -194,6 +287,15 @@ client_context_t* client_context_new(WiFiClient *wifiClient) {
 	c->step = HOMEKIT_CLIENT_STEP_NONE;
 	c->error_write = false;
 
+	c->output = NULL;
+	c->output_size = 0;
+	c->output_head = 0;
+	c->output_length = 0;
+
+	c->accessories_json = NULL;
+	c->accessories_cache = NULL;
+	c->accessories_next = 0;
+
 	return c;
 }
 
@@ -201,18 +303,15 @@ void client_context_free(client_context_t *c) {
 	if (c->verify_context)
 		pair_verify_context_free(c->verify_context);
 
-	if (c->event_queue) {
-		//c->event_queue->clear();
-		q_clean(c->event_queue);
-		q_kill(c->event_queue);
-		free(c->event_queue);
-	}
+	if (c->events)
+		free(c->events);
 
-	if (c->endpoint_params)
-		query_params_free(c->endpoint_params);
+	if (c->output) {
+		free(c->output);
+		c->server->output_total -= c->output_size;
+	}
 
-	if (c->body)
-		free(c->body);
+	arena_reset(&c->arena);
 
 	if (c->socket) {
 		c->socket->stop();
@@ -223,6 +322,19 @@ void client_context_free(client_context_t *c) {
 	free(c);
 }
 
+// (Re)allocates the empty events bitmap of a client
+bool client_events_new(client_context_t *c) {
+	if (c->events)
+		free(c->events);
+
+	size_t words = BITMAP_WORDS(c->server->characteristics_count);
+	if (!words)
+		words = 1;
+	c->events = (uint32_t*) calloc(words, sizeof(uint32_t));
+	c->events_pending = false;
+	return c->events != NULL;
+}
+
 pairing_context_t *saved_preinit_pairing_context = nullptr;
 
 pairing_context_t* pairing_context_new() {
@@ -231,9 +343,29 @@ pairing_context_t* pairing_context_new() {
 	context->client = NULL;
 	context->public_key = NULL;
 	context->public_key_size = 0;
+	context->srp_job = NULL;
+	context->srp_state = PAIRING_SRP_READY;
+	context->srp_setup = NULL;
+	context->device_public_key = NULL;
+	context->device_public_key_size = 0;
+	context->device_proof = NULL;
+	context->device_proof_size = 0;
 	return context;
 }
 
+// Ends the SRP computation of a pairing context, finished or not
+void pairing_context_srp_job_free(pairing_context_t *context) {
+	crypto_srp_job_free(context->srp_job);
+	context->srp_job = NULL;
+	context->srp_state = PAIRING_SRP_READY;
+	free(context->device_public_key);
+	context->device_public_key = NULL;
+	context->device_public_key_size = 0;
+	free(context->device_proof);
+	context->device_proof = NULL;
+	context->device_proof_size = 0;
+}
+
 void pairing_context_free(pairing_context_t *context) {
 	if (context == saved_preinit_pairing_context) {
 		INFO("Free saved_preinit_pairing_context");
@@ -241,6 +373,8 @@ void pairing_context_free(pairing_context_t *context) {
 			saved_preinit_pairing_context = nullptr;
 		}
 	}
+	pairing_context_srp_job_free(context);
+	free(context->srp_setup);
 	if (context->srp) {
 		crypto_srp_free(context->srp);
 	}
@@ -254,50 +388,47 @@ void pairing_context_free(pairing_context_t *context) {
 //pairing context
 //=====================
 
-void client_notify_characteristic(homekit_characteristic_t *ch, homekit_value_t value,
-		void *client);
+// The slot of a characteristic of the server's accessories, -1 for any other
+int server_characteristic_slot(const homekit_server_t *server, const homekit_characteristic_t *ch) {
+	if (ch->slot < server->characteristics_count && server->characteristics[ch->slot] == ch)
+		return ch->slot;
+	return -1;
+}
 
-void write_characteristic_json(json_stream *json, client_context_t *client,
-		const homekit_characteristic_t *ch, characteristic_format_t format,
-		const homekit_value_t *value) {
-	json_string(json, "aid");
+// The members which never change: aid, iid, type, perms and meta
+void write_characteristic_json_static(json_stream *json,
+		const homekit_characteristic_t *ch, characteristic_format_t format) {
+	json_key(json, "aid");
 	json_uint32(json, ch->service->accessory->id);
-	json_string(json, "iid");
+	json_key(json, "iid");
 	json_uint32(json, ch->id);
 
 	if (format & characteristic_format_type) {
-		json_string(json, "type");
+		json_key(json, "type");
 		json_string(json, ch->type);
 	}
 
 	if (format & characteristic_format_perms) {
-		json_string(json, "perms");
+		json_key(json, "perms");
 		json_array_start(json);
 		if (ch->permissions & homekit_permissions_paired_read)
-			json_string(json, "pr");
+			json_key(json, "pr");
 		if (ch->permissions & homekit_permissions_paired_write)
-			json_string(json, "pw");
+			json_key(json, "pw");
 		if (ch->permissions & homekit_permissions_notify)
-			json_string(json, "ev");
+			json_key(json, "ev");
 		if (ch->permissions & homekit_permissions_additional_authorization)
-			json_string(json, "aa");
+			json_key(json, "aa");
 		if (ch->permissions & homekit_permissions_timed_write)
-			json_string(json, "tw");
+			json_key(json, "tw");
 		if (ch->permissions & homekit_permissions_hidden)
-			json_string(json, "hd");
+			json_key(json, "hd");
 		json_array_end(json);
 	}
 
-	if ((format & characteristic_format_events) && (ch->permissions & homekit_permissions_notify)) {
-		bool events = homekit_characteristic_has_notify_callback(ch, client_notify_characteristic,
-				client);
-		json_string(json, "ev");
-		json_boolean(json, events);
-	}
-
 	if (format & characteristic_format_meta) {
 		if (ch->description) {
-			json_string(json, "description");
+			json_key(json, "description");
 			json_string(json, ch->description);
 		}
 
@@ -335,7 +466,7 @@ void write_characteristic_json(json_stream *json, client_context_t *client,
 			break;
 		}
 		if (format_str) {
-			json_string(json, "format");
+			json_key(json, "format");
 			json_string(json, format_str);
 		}
 
@@ -360,37 +491,37 @@ void write_characteristic_json(json_stream *json, client_context_t *client,
 			break;
 		}
 		if (unit_str) {
-			json_string(json, "unit");
+			json_key(json, "unit");
 			json_string(json, unit_str);
 		}
 
 		if (ch->min_value) {
-			json_string(json, "minValue");
+			json_key(json, "minValue");
 			json_float(json, *ch->min_value);
 		}
 
 		if (ch->max_value) {
-			json_string(json, "maxValue");
+			json_key(json, "maxValue");
 			json_float(json, *ch->max_value);
 		}
 
 		if (ch->min_step) {
-			json_string(json, "minStep");
+			json_key(json, "minStep");
 			json_float(json, *ch->min_step);
 		}
 
 		if (ch->max_len) {
-			json_string(json, "maxLen");
+			json_key(json, "maxLen");
 			json_uint32(json, *ch->max_len);
 		}
 
 		if (ch->max_data_len) {
-			json_string(json, "maxDataLen");
+			json_key(json, "maxDataLen");
 			json_uint32(json, *ch->max_data_len);
 		}
 
 		if (ch->valid_values.count) {
-			json_string(json, "valid-values");
+			json_key(json, "valid-values");
 			json_array_start(json);
 
 			for (int i = 0; i < ch->valid_values.count; i++) {
@@ -401,7 +532,7 @@ void write_characteristic_json(json_stream *json, client_context_t *client,
 		}
 
 		if (ch->valid_values_ranges.count) {
-			json_string(json, "valid-values-range");
+			json_key(json, "valid-values-range");
 			json_array_start(json);
 
 			for (int i = 0; i < ch->valid_values_ranges.count; i++) {
@@ -416,58 +547,70 @@ void write_characteristic_json(json_stream *json, client_context_t *client,
 			json_array_end(json);
 		}
 	}
+}
+
+// The members which depend on the client and the current value: ev and value
+void write_characteristic_json_state(json_stream *json, client_context_t *client,
+		const homekit_characteristic_t *ch, characteristic_format_t format,
+		const homekit_value_t *value) {
+	if ((format & characteristic_format_events) && (ch->permissions & homekit_permissions_notify)) {
+		int slot = server_characteristic_slot(client->server, ch);
+		bool events = slot >= 0 && (client->server->subscribers[slot] & (1 << client->index));
+		json_key(json, "ev");
+		json_boolean(json, events);
+	}
 
 	if (ch->permissions & homekit_permissions_paired_read) {
 		homekit_value_t v = value ? *value : ch->getter_ex ? ch->getter_ex(ch) : ch->value;
 
 		if (v.is_null) {
-			 json_string(json, "value"); json_null(json);
+			 json_key(json, "value"); json_null(json);
 		} else if (v.format != ch->format) {
 			ERROR("Characteristic value format is different from characteristic format");
 		} else {
 			switch (v.format) {
 			case homekit_format_bool: {
-				json_string(json, "value");
+				json_key(json, "value");
 				json_boolean(json, v.bool_value);
 				break;
 			}
 			case homekit_format_uint8: {
-				json_string(json, "value");
+				json_key(json, "value");
 				json_uint8(json, v.uint8_value);
 				break;
 			}
 			case homekit_format_uint16: {
-				json_string(json, "value");
+				json_key(json, "value");
 				json_uint16(json, v.uint16_value);
 				break;
 			}
 			case homekit_format_uint32: {
-				json_string(json, "value");
+				json_key(json, "value");
 				json_uint32(json, v.uint32_value);
 				break;
 			}
 			case homekit_format_uint64: {
-				json_string(json, "value");
+				json_key(json, "value");
 				json_uint64(json, v.uint64_value);
 				break;
 			}
 			case homekit_format_int: {
-				json_string(json, "value");
+				json_key(json, "value");
 				json_integer(json, v.int_value);
 				break;
 			}
 			case homekit_format_float: {
-				json_string(json, "value");
+				json_key(json, "value");
 				json_float(json, v.float_value);
 				break;
 			}
 			case homekit_format_string: {
-				json_string(json, "value");
+				json_key(json, "value");
 				json_string(json, v.string_value);
 				break;
 			}
 			case homekit_format_tlv: {
-				json_string(json, "value");
+				json_key(json, "value");
 				if (!v.tlv_values) {
 					json_string(json, "");
 				} else {
@@ -484,7 +627,7 @@ void write_characteristic_json(json_stream *json, client_context_t *client,
 						base64_encode_(tlv_data, tlv_size, encoded_tlv_data);
 						encoded_tlv_data[encoded_tlv_size] = 0;
 
-						json_string(json, (char*) encoded_tlv_data);
+						json_string_escaped(json, (char*) encoded_tlv_data, encoded_tlv_size);
 
 						free(encoded_tlv_data);
 						free(tlv_data);
@@ -493,7 +636,7 @@ void write_characteristic_json(json_stream *json, client_context_t *client,
 				break;
 			}
 			case homekit_format_data: {
-				json_string(json, "value");
+				json_key(json, "value");
 				if (!v.data_value || v.data_size == 0) {
 					json_string(json, "");
 				} else {
@@ -502,7 +645,7 @@ void write_characteristic_json(json_stream *json, client_context_t *client,
 					base64_encode_(v.data_value, v.data_size, encoded_data);
 					encoded_data[encoded_data_size] = 0;
 
-					json_string(json, (char*) encoded_data);
+					json_string_escaped(json, (char*) encoded_data, encoded_data_size);
 
 					free(encoded_data);
 				}
@@ -519,6 +662,98 @@ void write_characteristic_json(json_stream *json, client_context_t *client,
 	}
 }
 
+void write_characteristic_json(json_stream *json, client_context_t *client,
+		const homekit_characteristic_t *ch, characteristic_format_t format,
+		const homekit_value_t *value) {
+	write_characteristic_json_static(json, ch, format);
+	write_characteristic_json_state(json, client, ch, format, value);
+}
+
+// Sends as much of the queued output as the socket takes without blocking.
+// WiFiClient does not expose the lwIP sent callback, so this is polled from
+// homekit_client_process and before each write. The queue is freed once empty.
+void client_output_drain(client_context_t *context) {
+	while (context->output_length && context->socket) {
+		size_t size = context->socket->availableForWrite();
+		size_t contiguous = context->output_size - context->output_head;
+		if (size > contiguous)
+			size = contiguous;
+		if (size > context->output_length)
+			size = context->output_length;
+		if (!size)
+			break;
+
+		size_t written = context->socket->write(context->output + context->output_head, size);
+		if (!written)
+			break;
+		context->output_head = (context->output_head + written) % context->output_size;
+		context->output_length -= written;
+	}
+
+	if (!context->output_length && context->output) {
+		free(context->output);
+		context->server->output_total -= context->output_size;
+		context->output = NULL;
+		context->output_size = 0;
+		context->output_head = 0;
+	}
+}
+
+// Makes room for size more bytes in the queue, growing it up to
+// HOMEKIT_OUTPUT_BUFFER_MAX_SIZE and within HOMEKIT_OUTPUT_BUDGET.
+// Returns false if it cannot.
+bool client_output_reserve(client_context_t *context, size_t size) {
+	size_t needed = context->output_length + size;
+	if (needed <= context->output_size)
+		return true;
+
+	homekit_server_t *server = context->server;
+	size_t limit = HOMEKIT_OUTPUT_BUDGET - (server->output_total - context->output_size);
+	if (limit > HOMEKIT_OUTPUT_BUFFER_MAX_SIZE)
+		limit = HOMEKIT_OUTPUT_BUFFER_MAX_SIZE;
+	if (needed > limit)
+		return false;
+
+	size_t output_size = context->output_size ? context->output_size : HOMEKIT_OUTPUT_BUFFER_SIZE;
+	while (output_size < needed)
+		output_size *= 2;
+	if (output_size > limit)
+		output_size = limit;
+
+	byte *output = (byte*) malloc(output_size);
+	if (!output)
+		return false;
+
+	// The queued bytes are moved to the start of the new ring
+	size_t first = context->output_size - context->output_head;
+	if (first > context->output_length)
+		first = context->output_length;
+	if (context->output) {
+		memcpy(output, context->output + context->output_head, first);
+		memcpy(output + first, context->output, context->output_length - first);
+		free(context->output);
+	}
+	server->output_total += output_size - context->output_size;
+	context->output = output;
+	context->output_size = output_size;
+	context->output_head = 0;
+	return true;
+}
+
+bool client_output_queue(client_context_t *context, const byte *data, size_t data_size) {
+	if (!client_output_reserve(context, data_size))
+		return false;
+
+	size_t tail = (context->output_head + context->output_length) % context->output_size;
+	size_t size = context->output_size - tail;
+	if (size > data_size)
+		size = data_size;
+	memcpy(context->output + tail, data, size);
+	memcpy(context->output, data + size, data_size - size);
+	context->output_length += data_size;
+	return true;
+}
+
 void write(client_context_t *context, byte *data, int data_size) {
 	if ((!context) || (!context->socket) || (!context->socket->connected())) {
 		CLIENT_ERROR(context, "The socket is null! (or is closed)");
@@ -528,161 +763,380 @@ void write(client_context_t *context, byte *data, int data_size) {
 		CLIENT_ERROR(context, "Abort write data since error_write.");
 		return;
 	}
-	int write_size = context->socket->write(data, data_size);
 	CLIENT_DEBUG(context, "Sending data of size %d", data_size);
-	if (write_size != data_size) {
-		CLIENT_ERROR(context, "socket.write, data_size=%d, write_size=%d", data_size, write_size);
+
+	if (context->output_length)
+		client_output_drain(context);
+
+	if (!context->output_length) {
+		// Write what fits in the TCP send buffer now, queue the rest
+		size_t size = context->socket->availableForWrite();
+		if (size > (size_t) data_size)
+			size = data_size;
+		if (size) {
+			size_t written = context->socket->write(data, size);
+			data += written;
+			data_size -= written;
+		}
+		if (!data_size)
+			return;
+	}
+
+	if (!client_output_queue(context, data, data_size)) {
+		CLIENT_ERROR(context, "socket.write, data_size=%d, queued=%d",
+				(int) data_size, (int) context->output_length);
 		context->error_write = true;
-		// Error write when :
-		// 1. remote client is disconnected
-		// 2. data_size is larger than the tcp internal send buffer
-		// But We has limited the data_size to 538, and TCP_SND_BUF = 1072. (See the comments on HOMEKIT_JSONBUFFER_SIZE)
-		// So we believe here is disconnected.
+		// The remote client does not take its output fast enough. It is closed by
+		// homekit_client_process, not here in the middle of handling a request.
 		context->disconnect = true;
-		homekit_server_close_client(context->server, context);
-		// We consider the socket is 'closed' when error in writing (eg. the remote client is disconnected, NO tcp ack receive).
-		// Closing the socket causes memory-leak if some data has not been sent (the write_buffer did not free)
-		// To fix this memory-leak, add tcp_abandon(_pcb, 0); in ClientContext.h of ESP8266WiFi-library.
 	}
-
 }
 
-int client_send_encrypted_(client_context_t *context,
-		byte *payload, size_t size) {
-	CLIENT_DEBUG(context, "Send encrypted of size %d", size);
-	// max(size) = HOMEKIT_JSONBUFFER_SIZE + chunk_info(8) = 512 + 8 = 520
-	if (!context || !context->encrypted)
-		return -1;
+/*
+ HAP doc:
+ Each HTTP message is split into frames no larger than 1024 bytes.
+ Each frame has the following format:
+ <2:AAD for little endian length of encrypted data (n) in bytes>
+ <n:encrypted data according to AEAD algorithm, up to 1024 bytes>
+ <16:authTag according to AEAD algorithm>
+ Note by Wang Bin. 2020-03-07
+
+ The response is written into server->frame (after the 2-byte AAD) by client_write,
+ then client_flush encrypts it in place and sends it, so no malloc is needed.
+ */
+int client_flush(client_context_t *context) {
+	homekit_server_t *server = context->server;
+	size_t size = server->frame_size;
+
+	server->frame_size = 0;
+	server->frame_client = NULL;
+	if (!size)
+		return 0;
 
-	/*
-	 HAP doc:
-	 Each HTTP message is split into frames no larger than 1024 bytes.
-	 Each frame has the following format:
-	 <2:AAD for little endian length of encrypted data (n) in bytes>
-	 <n:encrypted data according to AEAD algorithm, up to 1024 bytes>
-	 <16:authTag according to AEAD algorithm>
-	 Note by Wang Bin. 2020-03-07
-	 */
+	if (!context->encrypted) {
+		write(context, server->frame + 2, size);
+		return 0;
+	}
+	CLIENT_DEBUG(context, "Send encrypted of size %d", size);
 
 	byte nonce[12];
 	memset(nonce, 0, sizeof(nonce));
 
-	byte encrypted[1024 + 18];
-	int payload_offset = 0;
+	byte i = 4;
+	int x = context->count_reads++;
+	while (x) {
+		nonce[i++] = x % 256;
+		x /= 256;
+	}
 
-	while (payload_offset < size) {
-		size_t chunk_size = size - payload_offset;
-		if (chunk_size > 1024)
-			chunk_size = 1024;
+	byte *aead = server->frame;
+	aead[0] = size % 256;
+	aead[1] = size / 256;
 
-		byte aead[2] = { chunk_size % 256, chunk_size / 256 };
+	size_t available = sizeof(server->frame) - 2;
+	int r = crypto_chacha20poly1305_encrypt(context->read_key, nonce, aead, 2,
+			server->frame + 2, size, server->frame + 2, &available);
+	if (r) {
+		ERROR("Failed to chacha encrypt payload (code %d)", r);
+		return -1;
+	}
 
-		memcpy(encrypted, aead, 2);
+	write(context, server->frame, available + 2);
+	return 0;
+}
 
-		byte i = 4;
-		int x = context->count_reads++;
-		while (x) {
-			nonce[i++] = x % 256;
-			x /= 256;
-		}
+void client_write(client_context_t *context, const byte *data, size_t data_size) {
+	homekit_server_t *server = context->server;
+	if (server->frame_client != context) {
+		if (server->frame_client)
+			client_flush(server->frame_client);
+		server->frame_client = context;
+	}
 
-		size_t available = sizeof(encrypted) - 2;
-		int r = crypto_chacha20poly1305_encrypt(context->read_key, nonce, aead, 2,
-				payload + payload_offset, chunk_size, encrypted + 2, &available);
-		if (r) {
-			ERROR("Failed to chacha encrypt payload (code %d)", r);
-			return -1;
-		}
+	while (data_size) {
+		size_t size = HOMEKIT_FRAME_SIZE - server->frame_size;
+		if (size > data_size)
+			size = data_size;
 
-		payload_offset += chunk_size;
+		memcpy(server->frame + 2 + server->frame_size, data, size);
+		server->frame_size += size;
+		data += size;
+		data_size -= size;
 
-		write(context, encrypted, available + 2);
+		if (server->frame_size == HOMEKIT_FRAME_SIZE) {
+			if (client_flush(context))
+				return;
+			server->frame_client = context;
+		}
 	}
+}
 
-	return 0;
+// client_write of a PROGMEM string, copied through a small buffer on the stack
+void client_write_P(client_context_t *context, PGM_P pgm) {
+	byte buffer[64];
+	size_t data_size = strlen_P(pgm);
+	while (data_size) {
+		size_t size = data_size < sizeof(buffer) ? data_size : sizeof(buffer);
+		memcpy_P(buffer, pgm, size);
+		client_write(context, buffer, size);
+		if (context->error_write)
+			return;
+		pgm += size;
+		data_size -= size;
+	}
 }
 
-int client_decrypt_(client_context_t *context,
-		byte *payload, size_t payload_size, byte *decrypted, size_t *decrypted_size) {
-	if (!context || !context->encrypted)
+// Decrypts in place the HAP frame at the start of data, <2:AAD><length:payload><16:authTag>,
+// the plaintext is left at data + 2. Returns the size of the frame, 0 if it is not
+// complete yet, or -1 if it is invalid.
+int client_decrypt_frame(client_context_t *context, byte *data, size_t data_size,
+		size_t *payload_size) {
+	if (data_size < 2)
+		return 0;
+
+	size_t size = data[0] + data[1] * 256;
+	if (size > HOMEKIT_FRAME_SIZE) {
+		CLIENT_ERROR(context, "Invalid frame size %d", (int) size);
 		return -1;
+	}
+	if (data_size < 2 + size + 16)
+		return 0;
 
-	const size_t block_size = 1024 + 16 + 2;
-	size_t required_decrypted_size = payload_size / block_size * 1024;
-	if (payload_size % block_size > 0)
-		required_decrypted_size += payload_size % block_size - 16 - 2;
+	byte nonce[12];
+	memset(nonce, 0, sizeof(nonce));
+	byte i = 4;
+	int x = context->count_writes++;
+	while (x) {
+		nonce[i++] = x % 256;
+		x /= 256;
+	}
 
-	if (*decrypted_size < required_decrypted_size) {
-		*decrypted_size = required_decrypted_size;
-		return -2;
+	*payload_size = size;
+	int r = crypto_chacha20poly1305_decrypt(context->write_key, nonce, data, 2, data + 2,
+			size + 16, data + 2, payload_size);
+	if (r) {
+		CLIENT_ERROR(context, "Failed to chacha decrypt payload (code %d)", r);
+		return -1;
 	}
 
-	*decrypted_size = required_decrypted_size;
+	return 2 + size + 16;
+}
 
-	byte nonce[12];
-	memset(nonce, 0, sizeof(nonce));
+// The notify callback of the characteristics with the notify permission, marks
+// the change for the subscribed clients. A change not sent yet is replaced by the
+// newer one. The EVENT messages are sent by homekit_server_process_notifications.
+void server_notify_characteristic(homekit_characteristic_t *ch, homekit_value_t value,
+		void *context) {
+	homekit_server_t *server = (homekit_server_t*) context;
+	int slot = server_characteristic_slot(server, ch);
+	if (slot < 0)
+		return;
 
-	int payload_offset = 0;
-	int decrypted_offset = 0;
+	uint8_t subscribers = server->subscribers[slot];
+	if (!subscribers)
+		return;
 
-	while (payload_offset < payload_size) {
-		size_t chunk_size = payload[payload_offset] + payload[payload_offset + 1] * 256;
-		if (chunk_size + 18 > payload_size - payload_offset) {
-			// Unfinished chunk
-			break;
-		}
+	for (client_context_t *client = server->clients; client; client = client->next) {
+		if (!(subscribers & (1 << client->index)))
+			continue;
 
-		byte i = 4;
-		int x = context->count_writes++;
-		while (x) {
-			nonce[i++] = x % 256;
-			x /= 256;
+		if (client->current_characteristic == ch && client->current_value
+				&& homekit_value_equal(client->current_value, &value)) {
+			// This value is set by this client, no need to send notification
+			CLIENT_DEBUG(client, "This value is set by this client, no need to send notification");
+			continue;
 		}
+		CLIENT_INFO(client, "Got characteristic %d.%d change event",
+				ch->service->accessory->id, ch->id);
 
-		size_t decrypted_len = *decrypted_size - decrypted_offset;
-		int r = crypto_chacha20poly1305_decrypt(context->write_key, nonce, payload + payload_offset,
-				2, payload + payload_offset + 2, chunk_size + 16, decrypted, &decrypted_len);
-		if (r) {
-			ERROR("Failed to chacha decrypt payload (code %d)", r);
-			return -1;
+		BITMAP_SET(client->events, slot);
+		if (!client->events_pending) {
+			client->events_pending = true;
+			client->events_time = millis();
 		}
+		server->events_pending = true;
+	}
+
+	homekit_value_destruct(&server->characteristic_values[slot]);
+	homekit_value_copy(&server->characteristic_values[slot], &value);
+}
 
-		decrypted_offset += decrypted_len;
-		payload_offset += chunk_size + 18;
+void server_characteristics_free(homekit_server_t *server) {
+	for (size_t i = 0; i < server->characteristics_count; i++) {
+		homekit_value_destruct(&server->characteristic_values[i]);
+	}
+	if (server->characteristics) {
+		free(server->characteristics);
+		server->characteristics = NULL;
+	}
+	if (server->characteristic_values) {
+		free(server->characteristic_values);
+		server->characteristic_values = NULL;
 	}
+	if (server->characteristic_sent_at) {
+		// events_ready and events_sent are in the same allocation
+		free(server->characteristic_sent_at);
+		server->characteristic_sent_at = NULL;
+		server->events_ready = NULL;
+		server->events_sent = NULL;
+	}
+	if (server->events_message) {
+		free(server->events_message);
+		server->events_message = NULL;
+	}
+	if (server->subscribers) {
+		free(server->subscribers);
+		server->subscribers = NULL;
+	}
+	server->characteristics_count = 0;
+}
 
-	return payload_offset;
+// The old slot of the characteristic in new slot, -1 if it is new
+static int server_characteristic_old_slot(homekit_characteristic_t **old_characteristics,
+		size_t old_count, const homekit_characteristic_t *ch, size_t slot) {
+	// Usually the characteristics before the change keep their slot
+	if (slot < old_count && old_characteristics[slot] == ch)
+		return slot;
+	for (size_t i = 0; i < old_count; i++) {
+		if (old_characteristics[i] == ch)
+			return i;
+	}
+	return -1;
 }
 
-void client_notify_characteristic(homekit_characteristic_t *ch, homekit_value_t value,
-		void *context) {
-	client_context_t *client = (client_context_t*) context;
+// Builds server->characteristics from the slots assigned by homekit_accessories_init.
+// Called again after the accessories change: the subscriptions, the changes not sent
+// yet and the last notified values of the characteristics still there are moved to
+// their new slots. The old table is only compared by pointer, a removed
+// characteristic may have been freed already.
+void server_characteristics_build(homekit_server_t *server) {
+	homekit_characteristic_t **old_characteristics = server->characteristics;
+	homekit_value_t *old_values = server->characteristic_values;
+	uint8_t *old_subscribers = server->subscribers;
+	size_t old_count = server->characteristics_count;
+	server->characteristics = NULL;
+	server->characteristic_values = NULL;
+	server->subscribers = NULL;
+	server->characteristics_count = 0;
+	server_characteristics_free(server);
+
+	size_t count = 0;
+	for (homekit_accessory_t **accessory_it = server->config->accessories; *accessory_it;
+			accessory_it++) {
+		for (homekit_service_t **service_it = (*accessory_it)->services; *service_it;
+				service_it++) {
+			for (homekit_characteristic_t **ch_it = (*service_it)->characteristics; *ch_it;
+					ch_it++) {
+				count++;
+			}
+		}
+	}
 
-	if (client->current_characteristic == ch && client->current_value
-			&& homekit_value_equal(client->current_value, &value)) {
-		// This value is set by this client, no need to send notification
-		CLIENT_DEBUG(client, "This value is set by this client, no need to send notification");
-		return;
+	if (count) {
+		server->characteristics = (homekit_characteristic_t**) calloc(count,
+				sizeof(homekit_characteristic_t*));
+		server->characteristic_values = (homekit_value_t*) calloc(count, sizeof(homekit_value_t));
+		server->events_message = (uint32_t*) calloc(BITMAP_WORDS(count), sizeof(uint32_t));
+		server->subscribers = (uint8_t*) calloc(count, sizeof(uint8_t));
+		if (!server->characteristics || !server->characteristic_values || !server->events_message
+				|| !server->subscribers) {
+			ERROR("Failed to allocate characteristics table");
+			server_characteristics_free(server);
+			count = 0;
+		}
 	}
-	CLIENT_INFO(client, "Got characteristic %d.%d change event",
-			ch->service->accessory->id, ch->id);
-	//DEBUG("Got characteristic %d.%d change event", ch->service->accessory->id, ch->id);
+	server->characteristics_count = count;
 
-	if (!client->event_queue) {
-		ERROR("Client has no event queue. Skipping notification");
-		return;
+	for (size_t i = 0; i < count; i++) {
+		server->characteristic_values[i].is_null = true;
 	}
 
-	characteristic_event_t *event = (characteristic_event_t*) malloc(
-			sizeof(characteristic_event_t));
-	event->characteristic = ch;
-	homekit_value_copy(&event->value, &value);
+	uint16_t min_interval = server->config->event_min_interval;
+	if (count && min_interval) {
+		size_t words = BITMAP_WORDS(count);
+		server->characteristic_sent_at = (uint32_t*) calloc(count + 2 * words, sizeof(uint32_t));
+		if (server->characteristic_sent_at) {
+			server->events_ready = server->characteristic_sent_at + count;
+			server->events_sent = server->events_ready + words;
+			// May be sent right away
+			uint32_t now = millis();
+			for (size_t i = 0; i < count; i++) {
+				server->characteristic_sent_at[i] = now - min_interval;
+			}
+		} else {
+			ERROR("Failed to allocate event times, event_min_interval is ignored");
+		}
+	}
 
-	DEBUG("Sending event to client %d", client->socket);
+	for (homekit_accessory_t **accessory_it = server->config->accessories; count && *accessory_it;
+			accessory_it++) {
+		for (homekit_service_t **service_it = (*accessory_it)->services; *service_it;
+				service_it++) {
+			for (homekit_characteristic_t **ch_it = (*service_it)->characteristics; *ch_it;
+					ch_it++) {
+				homekit_characteristic_t *ch = *ch_it;
+				if (ch->slot < count)
+					server->characteristics[ch->slot] = ch;
+				if (ch->permissions & homekit_permissions_notify)
+					homekit_characteristic_add_notify_callback(ch, server_notify_characteristic,
+							server);
+			}
+		}
+	}
 
-	//xQueueSendToBack(client->event_queue, &event, 10);*/
-	//q_push第二个参数要传指针地址
-	q_push(client->event_queue, &event);
+	// The old slot of each new one
+	int16_t *old_slots = NULL;
+	if (count && old_count) {
+		old_slots = (int16_t*) malloc(count * sizeof(int16_t));
+		if (!old_slots)
+			ERROR("Failed to allocate slots, the subscriptions are dropped");
+	}
+	for (size_t slot = 0; old_slots && slot < count; slot++) {
+		int i = server->characteristics[slot] ? server_characteristic_old_slot(
+				old_characteristics, old_count, server->characteristics[slot], slot) : -1;
+		old_slots[slot] = i;
+		if (i >= 0) {
+			server->subscribers[slot] = old_subscribers[i];
+			homekit_value_copy(&server->characteristic_values[slot], &old_values[i]);
+		}
+	}
+
+	client_context_t *client = server->clients;
+	while (client) {
+		client_context_t *next = client->next;
+		uint32_t *old_events = client->events;
+		client->events = NULL;
+		// Counted first, homekit_server_close_client clears them
+		uint8_t bit = 1 << client->index;
+		client->subscriptions_count = 0;
+		for (size_t slot = 0; old_slots && slot < count; slot++) {
+			if (server->subscribers[slot] & bit)
+				client->subscriptions_count++;
+		}
+		if (!client_events_new(client)) {
+			CLIENT_ERROR(client, "Failed to allocate events");
+			homekit_server_close_client(server, client);
+		} else if (old_slots && old_events) {
+			for (size_t slot = 0; slot < count; slot++) {
+				if (old_slots[slot] >= 0 && BITMAP_GET(old_events, old_slots[slot])) {
+					BITMAP_SET(client->events, slot);
+					client->events_pending = true;
+					server->events_pending = true;
+				}
+			}
+		}
+		if (old_events)
+			free(old_events);
+		client = next;
+	}
+
+	for (size_t i = 0; i < old_count; i++) {
+		homekit_value_destruct(&old_values[i]);
+	}
+	free(old_slots);
+	free(old_characteristics);
+	free(old_values);
+	free(old_subscribers);
 }
 
 void client_send(client_context_t *context, byte *data, size_t data_size) {
@@ -690,39 +1144,33 @@ void client_send(client_context_t *context, byte *data, size_t data_size) {
 	CLIENT_DEBUG(context, "send data size=%d, encrypted=%s",
 			data_size, context->encrypted ? "true" : "false");
 
-	if (context->encrypted) {
-		int r = client_send_encrypted_(context, data, data_size);
-		if (r) {
-			CLIENT_ERROR(context, "Failed to encrypt response (code %d)", r);
-			return;
-		}
-	} else {
-		write(context, data, data_size);
+	client_write(context, data, data_size);
+	int r = client_flush(context);
+	if (r) {
+		CLIENT_ERROR(context, "Failed to encrypt response (code %d)", r);
 	}
 }
 
 void client_send_P(client_context_t *context, PGM_P pgm) {
-	XPGM_BUFFCPY_STRING(char, buff, pgm);
-	client_send(context, (byte*)buff, sizeof(buff) - 1);
+	client_write_P(context, pgm);
+	client_flush(context);
 }
 
 void client_send_chunk(byte *data, size_t size, void *arg) {
 	client_context_t *context = (client_context_t*) arg;
 
-	size_t payload_size = size + 8;
-	byte *payload = (byte*) malloc(payload_size);
-	if (!payload) {
-		ERROR("Error malloc payload!! payload_size->%d", payload_size);
-		return;
-	}
-
-	int offset = snprintf((char*) payload, payload_size, "%x\r\n", size);
-	memcpy(payload + offset, data, size);
-	payload[offset + size] = '\r';
-	payload[offset + size + 1] = '\n';
+	char chunk_header[12];
+	int offset = snprintf(chunk_header, sizeof(chunk_header), "%x\r\n", (unsigned) size);
 	CLIENT_DEBUG(context, "client_send_chunk, size=%d, offset=%d", size, offset);
-	client_send(context, payload, offset + size + 2);
-	free(payload);
+
+	client_write(context, (byte*) chunk_header, offset);
+	client_write(context, data, size);
+	client_write(context, (const byte*) "\r\n", 2);
+#if HOMEKIT_COALESCE_FRAMES
+	if (size)
+		return; // the last 0-chunk ends the response and flushes the frame
+#endif
+	client_flush(context);
 }
 
 void send_204_response(client_context_t *context) {
@@ -735,29 +1183,92 @@ void send_404_response(client_context_t *context) {
 	client_send_P(context, response);
 }
 
-void send_client_events(client_context_t *context, client_event_t *events) {
-	CLIENT_DEBUG(context, "Sending EVENT");DEBUG_HEAP();
+// Whether a client has changes to be sent, after event_batch_window
+bool client_events_due(client_context_t *context, uint32_t now) {
+	uint16_t batch_window = context->server->config->event_batch_window;
 
-	static const char PROGMEM http_headers[] = "EVENT/1.0 200 OK\r\n"
-			"Content-Type: application/hap+json\r\n"
-			"Transfer-Encoding: chunked\r\n\r\n";
-	client_send_P(context, http_headers);
+	// Not in the middle of a response, nor while the client does not take its output
+	return context->step == HOMEKIT_CLIENT_STEP_PAIR_VERIFY_2OF2 && context->events_pending
+			&& !context->accessories_json && context->output_length < HOMEKIT_OUTPUT_RESUME_SIZE
+			&& (!batch_window || (uint32_t) (now - context->events_time) >= batch_window);
+}
+
+// Selects the characteristics of the next EVENT message of a client: the ones marked
+// in context->events and in the mask (all of them for a NULL mask). Returns false if
+// there are none.
+bool client_events_select(client_context_t *context, const uint32_t *mask, uint32_t *message) {
+	size_t words = BITMAP_WORDS(context->server->characteristics_count);
+
+	bool send = false;
+	bool pending = false;
+	for (size_t i = 0; i < words; i++) {
+		message[i] = mask ? context->events[i] & mask[i] : context->events[i];
+		if (message[i])
+			send = true;
+		if (context->events[i])
+			pending = true;
+	}
+	context->events_pending = pending; // the changes may have been unsubscribed
+	return send;
+}
+
+// Whether the next EVENT message of a client has the selected characteristics
+bool client_events_match(client_context_t *context, const uint32_t *mask,
+		const uint32_t *message) {
+	size_t words = BITMAP_WORDS(context->server->characteristics_count);
+
+	for (size_t i = 0; i < words; i++) {
+		uint32_t bits = mask ? context->events[i] & mask[i] : context->events[i];
+		if (bits != message[i])
+			return false;
+	}
+	return true;
+}
+
+void event_message_on_flush(uint8_t *buffer, size_t size, void *arg) {
+	event_message_t *message = (event_message_t*) arg;
+	if (message->error)
+		return;
+
+	if (message->size + size > message->capacity) {
+		size_t capacity = message->capacity + HOMEKIT_JSONBUFFER_SIZE;
+		byte *data = (byte*) realloc(message->data, capacity);
+		if (!data) {
+			message->error = true;
+			return;
+		}
+		message->data = data;
+		message->capacity = capacity;
+	}
+	memcpy(message->data + message->size, buffer, size);
+	message->size += size;
+}
+
+// Renders the json of the characteristics in the message bitmap,
+// with the last notified values
+bool event_message_render(homekit_server_t *server, const uint32_t *events,
+		event_message_t *message) {
+	message->data = NULL;
+	message->size = 0;
+	message->capacity = 0;
+	message->error = false;
 
-	// ~35 bytes per event JSON
-	// 256 should be enough for ~7 characteristic updates
-	json_stream *json = json_new(HOMEKIT_JSONBUFFER_SIZE, client_send_chunk, context);
+	json_stream *json = json_new(HOMEKIT_JSONBUFFER_SIZE, event_message_on_flush, message);
 	json_object_start(json);
-	json_string(json, "characteristics");
+	json_key(json, "characteristics");
 	json_array_start(json);
 
-	client_event_t *e = events;
-	while (e) {
-		json_object_start(json);
-		write_characteristic_json(json, context, e->characteristic, (characteristic_format_t) 0,
-				&e->value);
-		json_object_end(json);
+	for (size_t i = 0; i < BITMAP_WORDS(server->characteristics_count); i++) {
+		uint32_t bits = events[i];
+		while (bits) {
+			size_t slot = i * 32 + __builtin_ctz(bits);
+			bits &= bits - 1;
 
-		e = e->next;
+			json_object_start(json);
+			write_characteristic_json(json, NULL, server->characteristics[slot],
+					(characteristic_format_t) 0, &server->characteristic_values[slot]);
+			json_object_end(json);
+		}
 	}
 
 	json_array_end(json);
@@ -766,7 +1277,39 @@ void send_client_events(client_context_t *context, client_event_t *events) {
 	json_flush(json);
 	json_free(json);
 
-	client_send_chunk(NULL, 0, context);
+	if (message->error) {
+		ERROR("Failed to allocate EVENT message (%d bytes)", (int) message->size);
+		free(message->data);
+		message->data = NULL;
+		return false;
+	}
+	return true;
+}
+
+// Sends a rendered EVENT message and clears its characteristics in context->events
+void send_client_events(client_context_t *context, const event_message_t *message,
+		const uint32_t *events) {
+	CLIENT_DEBUG(context, "Sending EVENT");DEBUG_HEAP();
+
+	static const char PROGMEM http_headers[] = "EVENT/1.0 200 OK\r\n"
+			"Content-Type: application/hap+json\r\n"
+			"Transfer-Encoding: chunked\r\n\r\n";
+	client_write_P(context, http_headers);
+
+	// The json in one chunk, then the last 0-chunk
+	char chunk_header[12];
+	int offset = snprintf(chunk_header, sizeof(chunk_header), "%x\r\n", (unsigned) message->size);
+	client_write(context, (byte*) chunk_header, offset);
+	client_write(context, message->data, message->size);
+	client_write(context, (const byte*) "\r\n0\r\n\r\n", 7);
+	client_flush(context);
+
+	context->events_pending = false;
+	for (size_t i = 0; i < BITMAP_WORDS(context->server->characteristics_count); i++) {
+		context->events[i] &= ~events[i];
+		if (context->events[i])
+			context->events_pending = true;
+	}
 }
 
 void send_tlv_response(client_context_t *context, tlv_values_t *values);
@@ -785,11 +1328,11 @@ void send_tlv_response(client_context_t *context, tlv_values_t *values) {
 	size_t payload_size = 0;
 	tlv_format(values, NULL, &payload_size);
 
-	byte *payload = (byte*) malloc(payload_size);
-	int r = tlv_format(values, payload, &payload_size);
+	byte *payload = (byte*) arena_alloc(&context->arena, payload_size);
+	int r = payload ? tlv_format(values, payload, &payload_size) : -1;
 	if (r) {
 		CLIENT_ERROR(context, "Failed to format TLV payload (code %d)", r);
-		free(payload);
+		tlv_free(values);
 		return;
 	}
 
@@ -802,25 +1345,12 @@ void send_tlv_response(client_context_t *context, tlv_values_t *values) {
 
 	XPGM_BUFFCPY_STRING(char, http_headers, http_headers_pgm);
 
-	int response_size = strlen(http_headers) + payload_size + 32;
-	char *response = (char*) malloc(response_size);
-	int response_len = snprintf(response, response_size, http_headers, payload_size);
-
-	if (response_size - response_len < payload_size + 1) {
-		CLIENT_ERROR(context, "Incorrect response buffer size %d: headers took %d, payload size %d",
-				response_size, response_len, payload_size);
-		free(response);
-		free(payload);
-		return;
-	}
-	memcpy(response + response_len, payload, payload_size);
-	response_len += payload_size;
+	char response[sizeof(http_headers) + 16];
+	int response_len = snprintf(response, sizeof(response), http_headers, payload_size);
 
-	free(payload);
-
-	client_send(context, (byte*) response, response_len);
-
-	free(response);
+	client_write(context, (byte*) response, response_len);
+	client_write(context, payload, payload_size);
+	client_flush(context);
 }
 
 static const char PROGMEM json_200_response_headers_progmem[] = "HTTP/1.1 200 OK\r\n"
@@ -874,30 +1404,15 @@ void send_json_response(client_context_t *context, int status_code, byte *payloa
 		break;
 	}
 
-	int response_size = strlen(http_headers) + payload_size + strlen(status_text) + 32;
-	char *response = (char*) malloc(response_size);
-	if (!response) {
-		CLIENT_ERROR(context, "Failed to allocate response buffer of size %d", response_size);
-		return;
-	}
-	int response_len = snprintf(response, response_size, http_headers, status_code, status_text,
+	char response[sizeof(http_headers) + sizeof(status_text) + 16];
+	int response_len = snprintf(response, sizeof(response), http_headers, status_code, status_text,
 			payload_size);
 
-	if (response_size - response_len < payload_size + 1) {
-		CLIENT_ERROR(context, "Incorrect response buffer size %d: headers took %d, payload size %d",
-				response_size, response_len, payload_size);
-		free(response);
-		return;
-	}
-	memcpy(response + response_len, payload, payload_size);
-	response_len += payload_size;
-	response[response_len] = 0;  // required for debug output
-
 	CLIENT_DEBUG(context, "Sending HTTP response: %s", response);
 
-	client_send(context, (byte*) response, response_len);
-
-	free(response);
+	client_write(context, (byte*) response, response_len);
+	client_write(context, payload, payload_size);
+	client_flush(context);
 }
 
 void send_json_error_response(client_context_t *context, int status_code, HAPStatus status) {
@@ -907,6 +1422,18 @@ void send_json_error_response(client_context_t *context, int status_code, HAPSta
 	send_json_response(context, status_code, buffer, size);
 }
 
+// A json stream for a response, allocated in the arena of the request
+json_stream *client_json_new(client_context_t *context, json_flush_callback on_flush) {
+	json_stream *json = (json_stream*) arena_alloc(&context->arena, json_stream_size());
+	uint8_t *buffer = (uint8_t*) arena_alloc(&context->arena, HOMEKIT_JSONBUFFER_SIZE);
+	if (!json || !buffer) {
+		CLIENT_ERROR(context, "Failed to allocate the json stream");
+		return NULL;
+	}
+	json_init(json, buffer, HOMEKIT_JSONBUFFER_SIZE, on_flush, context);
+	return json;
+}
+
 homekit_client_id_t homekit_get_client_id() {
 	return (homekit_client_id_t) current_client_context;
 }
@@ -955,6 +1482,77 @@ void homekit_server_on_identify(client_context_t *context) {
 	}
 }
 
+// Pair Setup M2: the salt and the server public key
+void pair_setup_send_m2(client_context_t *context) {
+	int r = 0;
+	size_t salt_size = 0;
+	crypto_srp_get_salt(context->server->pairing_context->srp, NULL, &salt_size);
+	byte *salt = (byte*) malloc(salt_size);
+	r = crypto_srp_get_salt(context->server->pairing_context->srp, salt, &salt_size);
+	if (r) {
+		CLIENT_ERROR(context, "Failed to get salt (code %d)", r);
+		free(salt);
+		pairing_context_free(context->server->pairing_context);
+		context->server->pairing_context = NULL;
+		send_tlv_error_response(context, 2, TLVError_Unknown);
+		return;
+	}
+	tlv_values_t *response = tlv_new();
+	tlv_add_value(response, TLVType_PublicKey, context->server->pairing_context->public_key,
+			context->server->pairing_context->public_key_size);
+	tlv_add_value(response, TLVType_Salt, salt, salt_size);
+	tlv_add_integer_value(response, TLVType_State, 1, 2);
+	free(salt);
+	send_tlv_response(context, response);
+	context->step = HOMEKIT_CLIENT_STEP_PAIR_SETUP_1OF3;
+}
+
+// Pair Setup M4, once the shared secret of M3 is computed: verifies the device proof
+// and sends the server proof
+void pair_setup_send_m4(client_context_t *context) {
+	pairing_context_t *pairing_context = context->server->pairing_context;
+	int r = crypto_srp_compute_key_finish(pairing_context->srp, pairing_context->srp_job,
+			pairing_context->device_public_key, pairing_context->device_public_key_size,
+			pairing_context->public_key, pairing_context->public_key_size);
+	if (r) {
+		CLIENT_ERROR(context, "Failed to compute SRP shared secret (code %d)", r);
+		pairing_context_srp_job_free(pairing_context);
+		send_tlv_error_response(context, 4, TLVError_Authentication);
+		return;
+	}
+
+	free(pairing_context->public_key);
+	pairing_context->public_key = NULL;
+	pairing_context->public_key_size = 0;
+
+	CLIENT_DEBUG(context, "Verifying peer's proof");
+
+	r = crypto_srp_verify(pairing_context->srp, pairing_context->device_proof,
+			pairing_context->device_proof_size);
+	pairing_context_srp_job_free(pairing_context);
+
+	if (r) {
+		CLIENT_ERROR(context, "Failed to verify peer's proof (code %d)", r);
+		send_tlv_error_response(context, 4, TLVError_Authentication);
+		return;
+	}
+	CLIENT_DEBUG(context, "Generating own proof");
+	size_t server_proof_size = 0;
+	crypto_srp_get_proof(pairing_context->srp, NULL, &server_proof_size);
+
+	byte *server_proof = (byte*) malloc(server_proof_size);
+	//watchdog_check_begin();
+	r = crypto_srp_get_proof(pairing_context->srp, server_proof, &server_proof_size);
+	//watchdog_check_end("crypto_srp_get_proof");// 1ms
+
+	tlv_values_t *response = tlv_new();
+	tlv_add_integer_value(response, TLVType_State, 1, 4);
+	tlv_add_value(response, TLVType_Proof, server_proof, server_proof_size);
+	free(server_proof);
+	send_tlv_response(context, response);
+	context->step = HOMEKIT_CLIENT_STEP_PAIR_SETUP_2OF3;
+}
+
 void homekit_server_on_pair_setup(client_context_t *context, const byte *data, size_t size) {
 	DEBUG("Pair Setup");DEBUG_HEAP();
 	DEBUG_TIME_BEGIN();
@@ -1001,31 +1599,24 @@ void homekit_server_on_pair_setup(client_context_t *context, const byte *data, s
 			context->server->pairing_context->client = context;
 		}
 
-		int r = 0;
-		size_t salt_size = 0;
-		crypto_srp_get_salt(context->server->pairing_context->srp, NULL, &salt_size);
-		byte *salt = (byte*) malloc(salt_size);
-		r = crypto_srp_get_salt(context->server->pairing_context->srp, salt, &salt_size);
-		if (r) {
-			CLIENT_ERROR(context, "Failed to get salt (code %d)", r);
-			free(salt);
-			pairing_context_free(context->server->pairing_context);
-			context->server->pairing_context = NULL;
-			send_tlv_error_response(context, 2, TLVError_Unknown);
+		if (context->server->pairing_context->srp_state != PAIRING_SRP_READY) {
+			// M2 is sent by homekit_server_process_srp once the public key is computed
+			CLIENT_INFO(context, "Waiting for the SRP setup");
 			break;
 		}
-		tlv_values_t *response = tlv_new();
-		tlv_add_value(response, TLVType_PublicKey, context->server->pairing_context->public_key,
-				context->server->pairing_context->public_key_size);
-		tlv_add_value(response, TLVType_Salt, salt, salt_size);
-		tlv_add_integer_value(response, TLVType_State, 1, 2);
-		free(salt);
-		send_tlv_response(context, response);
-		context->step = HOMEKIT_CLIENT_STEP_PAIR_SETUP_1OF3;
+		pair_setup_send_m2(context);
 		break;
 	}
 	case 3: {
 		CLIENT_INFO(context, "Pair Setup Step 2/3");DEBUG_HEAP();
+		pairing_context_t *pairing_context = context->server->pairing_context;
+		if (!pairing_context || pairing_context->client != context
+				|| pairing_context->srp_state != PAIRING_SRP_READY) {
+			CLIENT_ERROR(context, "Unexpected Pair Setup M3");
+			send_tlv_error_response(context, 4, TLVError_Unknown);
+			break;
+		}
+
 		tlv_t *device_public_key = tlv_get_value(message, TLVType_PublicKey);
 		if (!device_public_key) {
 			CLIENT_ERROR(context, "Invalid payload: no device public key");
@@ -1041,54 +1632,33 @@ void homekit_server_on_pair_setup(client_context_t *context, const byte *data, s
 		}
 		CLIENT_DEBUG(context, "Computing SRP shared secret");
 		DEBUG_HEAP();
-		watchdog_disable_all();
-		watchdog_check_begin();
-		int r = crypto_srp_compute_key(context->server->pairing_context->srp,
-				device_public_key->value, device_public_key->size,
-				context->server->pairing_context->public_key,
-				context->server->pairing_context->public_key_size);
-		watchdog_check_end("crypto_srp_compute_key"); // 13479ms
-		watchdog_enable_all();
-
-		delay(10);
-
-		if (r) {
-			CLIENT_ERROR(context, "Failed to compute SRP shared secret (code %d)", r);
-			send_tlv_error_response(context, 4, TLVError_Authentication);
-			break;
+#if HOMEKIT_SRP_CACHE
+		// The server key of this attempt is not used again
+		homekit_storage_srp_key_used();
+#endif
+		// Kept for pair_setup_send_m4
+		pairing_context->device_public_key = (byte*) malloc(device_public_key->size);
+		pairing_context->device_proof = (byte*) malloc(proof->size);
+		int r = -1;
+		if (pairing_context->device_public_key && pairing_context->device_proof) {
+			memcpy(pairing_context->device_public_key, device_public_key->value,
+					device_public_key->size);
+			pairing_context->device_public_key_size = device_public_key->size;
+			memcpy(pairing_context->device_proof, proof->value, proof->size);
+			pairing_context->device_proof_size = proof->size;
+			r = crypto_srp_compute_key_begin(pairing_context->srp,
+					device_public_key->value, device_public_key->size,
+					pairing_context->public_key, pairing_context->public_key_size,
+					&pairing_context->srp_job);
 		}
-
-		free(context->server->pairing_context->public_key);
-		context->server->pairing_context->public_key = NULL;
-		context->server->pairing_context->public_key_size = 0;
-
-		CLIENT_DEBUG(context, "Verifying peer's proof");
-
-		//watchdog_check_begin();
-		r = crypto_srp_verify(context->server->pairing_context->srp, proof->value, proof->size);
-		//watchdog_check_end("crypto_srp_verify");// 1ms
-
 		if (r) {
-			CLIENT_ERROR(context, "Failed to verify peer's proof (code %d)", r);
+			CLIENT_ERROR(context, "Failed to compute SRP shared secret (code %d)", r);
+			pairing_context_srp_job_free(pairing_context);
 			send_tlv_error_response(context, 4, TLVError_Authentication);
 			break;
 		}
-		CLIENT_DEBUG(context, "Generating own proof");
-		size_t server_proof_size = 0;
-		crypto_srp_get_proof(context->server->pairing_context->srp, NULL, &server_proof_size);
-
-		byte *server_proof = (byte*) malloc(server_proof_size);
-		//watchdog_check_begin();
-		r = crypto_srp_get_proof(context->server->pairing_context->srp, server_proof,
-				&server_proof_size);
-		//watchdog_check_end("crypto_srp_get_proof");// 1ms
-
-		tlv_values_t *response = tlv_new();
-		tlv_add_integer_value(response, TLVType_State, 1, 4);
-		tlv_add_value(response, TLVType_Proof, server_proof, server_proof_size);
-		free(server_proof);
-		send_tlv_response(context, response);
-		context->step = HOMEKIT_CLIENT_STEP_PAIR_SETUP_2OF3;
+		// M4 is sent by homekit_server_process_srp once the shared secret is computed
+		pairing_context->srp_state = PAIRING_SRP_COMPUTE_KEY;
 		break;
 	}
 	case 5: {
@@ -1785,82 +2355,220 @@ void homekit_server_on_pair_verify(client_context_t *context, const byte *data,
 
 void homekit_client_process(client_context_t *context);
 
-void homekit_server_on_get_accessories(client_context_t *context) {
-	DEBUG_TIME_BEGIN();
-	CLIENT_INFO(context, "Get Accessories");DEBUG_HEAP();
-	client_send_P(context, json_200_response_headers_progmem);
+#define ACCESSORIES_CHARACTERISTIC_FORMAT ((characteristic_format_t) (characteristic_format_type \
+		| characteristic_format_meta | characteristic_format_perms | characteristic_format_events))
 
-	CLIENT_DEBUG(context, "Get Accessories, start send json body");
-
-	json_stream *json = json_new(HOMEKIT_JSONBUFFER_SIZE, client_send_chunk, context);
+// Writes one accessory of the /accessories json. With a cache, the characteristics are
+// written without ev and value and each closing "}" is recorded as a splice point.
+void write_accessory_json(json_stream *json, client_context_t *context,
+		homekit_accessory_t *accessory, accessories_cache_t *cache) {
 	json_object_start(json);
-	json_string(json, "accessories");
-	json_array_start(json);
 
-	for (homekit_accessory_t **accessory_it = context->server->config->accessories;
-			*accessory_it; accessory_it++) {
+	json_key(json, "aid");
+	json_uint32(json, accessory->id);
+	json_key(json, "services");
+	json_array_start(json);
 
-		homekit_accessory_t *accessory = *accessory_it;
+	for (homekit_service_t **service_it = accessory->services; *service_it; service_it++) {
+		homekit_service_t *service = *service_it;
 
 		json_object_start(json);
 
-		json_string(json, "aid");
-		json_uint32(json, accessory->id);
-		json_string(json, "services");
+		json_key(json, "iid");
+		json_uint32(json, service->id);
+		json_key(json, "type");
+		json_string(json, service->type);
+		json_key(json, "hidden");
+		json_boolean(json, service->hidden);
+		json_key(json, "primary");
+		json_boolean(json, service->primary);
+		if (service->linked) {
+			json_key(json, "linked");
+			json_array_start(json);
+			for (homekit_service_t **linked = service->linked; *linked; linked++) {
+				json_uint32(json, (*linked)->id);
+			}
+			json_array_end(json);
+		}
+
+		json_key(json, "characteristics");
 		json_array_start(json);
 
-		for (homekit_service_t **service_it = accessory->services; *service_it; service_it++) {
-			homekit_service_t *service = *service_it;
+		for (homekit_characteristic_t **ch_it = service->characteristics; *ch_it; ch_it++) {
+			homekit_characteristic_t *ch = *ch_it;
 
 			json_object_start(json);
-
-			json_string(json, "iid");
-			json_uint32(json, service->id);
-			json_string(json, "type");
-			json_string(json, service->type);
-			json_string(json, "hidden");
-			json_boolean(json, service->hidden);
-			json_string(json, "primary");
-			json_boolean(json, service->primary);
-			if (service->linked) {
-				json_string(json, "linked");
-				json_array_start(json);
-				for (homekit_service_t **linked = service->linked; *linked; linked++) {
-					json_uint32(json, (*linked)->id);
+			if (cache) {
+				write_characteristic_json_static(json, ch, ACCESSORIES_CHARACTERISTIC_FORMAT);
+				json_flush(json);
+				if (cache->splices) {
+					cache->splices[cache->splices_count].offset = cache->size;
+					cache->splices[cache->splices_count].characteristic = ch;
 				}
-				json_array_end(json);
-			}
-
-			json_string(json, "characteristics");
-			json_array_start(json);
-
-			for (homekit_characteristic_t **ch_it = service->characteristics; *ch_it; ch_it++) {
-				homekit_characteristic_t *ch = *ch_it;
-
-				json_object_start(json);
+				cache->splices_count++;
+			} else {
 				write_characteristic_json(json, context, ch,
-						(characteristic_format_t) (characteristic_format_type
-								| characteristic_format_meta | characteristic_format_perms
-								| characteristic_format_events),
-						NULL);
-				json_object_end(json);
+						ACCESSORIES_CHARACTERISTIC_FORMAT, NULL);
 			}
-
-			json_array_end(json);
-			json_object_end(json); // service
+			json_object_end(json);
 		}
 
 		json_array_end(json);
-		json_object_end(json); // accessory
+		json_object_end(json); // service
+	}
+
+	json_array_end(json);
+	json_object_end(json); // accessory
+}
+
+void write_accessories_json(json_stream *json, client_context_t *context,
+		accessories_cache_t *cache) {
+	json_object_start(json);
+	json_key(json, "accessories");
+	json_array_start(json);
+
+	for (homekit_accessory_t **accessory_it = context->server->config->accessories;
+			*accessory_it; accessory_it++) {
+		write_accessory_json(json, context, *accessory_it, cache);
 	}
 
 	json_array_end(json);
 	json_object_end(json); // response
 
 	json_flush(json);
+}
+
+void accessories_cache_on_flush(uint8_t *buffer, size_t size, void *arg) {
+	accessories_cache_t *cache = (accessories_cache_t*) arg;
+	if (cache->data) {
+		memcpy(cache->data + cache->size, buffer, size);
+	}
+	cache->size += size;
+}
+
+void accessories_cache_free(accessories_cache_t *cache) {
+	if (cache->data)
+		free(cache->data);
+	if (cache->splices)
+		free(cache->splices);
+	free(cache);
+}
+
+// Renders the skeleton twice: once to measure it, once into exactly sized buffers.
+accessories_cache_t* accessories_cache_new(client_context_t *context) {
+	accessories_cache_t *cache = (accessories_cache_t*) calloc(1, sizeof(accessories_cache_t));
+	if (!cache)
+		return NULL;
+
+	json_stream *json = json_new(HOMEKIT_JSONBUFFER_SIZE, accessories_cache_on_flush, cache);
+	write_accessories_json(json, context, cache);
 	json_free(json);
 
-	client_send_chunk(NULL, 0, context);
+	size_t size = cache->size;
+	size_t splices_count = cache->splices_count;
+	cache->data = (byte*) malloc(size);
+	cache->splices = (accessories_cache_splice_t*) malloc(
+			splices_count * sizeof(accessories_cache_splice_t) + 1);
+	if (!cache->data || !cache->splices) {
+		CLIENT_ERROR(context, "Failed to allocate accessories cache of size %d", (int) size);
+		accessories_cache_free(cache);
+		return NULL;
+	}
+	cache->size = 0;
+	cache->splices_count = 0;
+
+	json = json_new(HOMEKIT_JSONBUFFER_SIZE, accessories_cache_on_flush, cache);
+	write_accessories_json(json, context, cache);
+	json_free(json);
+
+	if (cache->size != size || cache->splices_count != splices_count) {
+		CLIENT_ERROR(context, "Accessories cache size changed while rendering");
+		accessories_cache_free(cache);
+		return NULL;
+	}
+	CLIENT_INFO(context, "Accessories cache: %d bytes, %d characteristics", (int) size,
+			(int) splices_count);
+	return cache;
+}
+
+// Writes the GET /accessories response started by homekit_server_on_get_accessories,
+// one splice of the cache (or one accessory) at a time, until it is complete or more
+// than HOMEKIT_OUTPUT_RESUME_SIZE is queued for the client. In the latter case it is
+// called again by homekit_client_process once the queue has drained.
+void client_send_accessories(client_context_t *context) {
+	json_stream *json = context->accessories_json;
+	accessories_cache_t *cache = context->accessories_cache;
+	homekit_accessory_t **accessories = context->server->config->accessories;
+
+	while (!context->error_write) {
+		if (context->output_length >= HOMEKIT_OUTPUT_RESUME_SIZE) {
+			// Paused: the frame is sent as it is, the server frame is shared
+			json_flush(json);
+			client_flush(context);
+			if (!context->error_write)
+				return;
+			break;
+		}
+
+		size_t i = context->accessories_next++;
+		if (cache) {
+			size_t offset = i ? cache->splices[i - 1].offset + 1 : 0; // after the "}"
+			if (i == cache->splices_count) {
+				json_raw(json, cache->data + offset, cache->size - offset);
+				break;
+			}
+			const accessories_cache_splice_t *splice = &cache->splices[i];
+			json_raw(json, cache->data + offset, splice->offset - offset);
+			json_object_resume(json);
+			write_characteristic_json_state(json, context, splice->characteristic,
+					ACCESSORIES_CHARACTERISTIC_FORMAT, NULL);
+			json_object_end(json);
+		} else {
+			if (!accessories[i]) {
+				json_array_end(json);
+				json_object_end(json); // response
+				break;
+			}
+			write_accessory_json(json, context, accessories[i], NULL);
+		}
+	}
+
+	if (!context->error_write) {
+		json_flush(json);
+		client_send_chunk(NULL, 0, context);
+	}
+	context->accessories_json = NULL;
+	context->accessories_cache = NULL;
+	arena_reset(&context->arena); // kept by homekit_server_on_message_complete
+}
+
+void homekit_server_on_get_accessories(client_context_t *context) {
+	DEBUG_TIME_BEGIN();
+	CLIENT_INFO(context, "Get Accessories");DEBUG_HEAP();
+	json_stream *json = client_json_new(context, client_send_chunk);
+	if (!json) {
+		send_json_error_response(context, 500, HAPStatus_OutOfResources);
+		return;
+	}
+	client_write_P(context, json_200_response_headers_progmem);
+
+	CLIENT_DEBUG(context, "Get Accessories, start send json body");
+
+	homekit_server_t *server = context->server;
+#if HOMEKIT_ACCESSORIES_CACHE
+	if (!server->accessories_cache) {
+		server->accessories_cache = accessories_cache_new(context);
+	}
+#endif
+	context->accessories_json = json;
+	context->accessories_cache = server->accessories_cache;
+	context->accessories_next = 0;
+	if (!context->accessories_cache) {
+		json_object_start(json);
+		json_key(json, "accessories");
+		json_array_start(json);
+	}
+	client_send_accessories(context);
 	DEBUG_TIME_END("get_accessories")
 }
 
@@ -1869,13 +2577,22 @@ bool bool_endpoint_param(const char *name, client_context_t *context) {
 	return param && param->value && !strcmp(param->value, "1");
 }
 
+// Most controllers ask for a few characteristics at once
+#define HOMEKIT_GET_CHARACTERISTICS_IDS 16
+
+typedef struct {
+	uint32_t aid;
+	uint32_t iid;
+	homekit_characteristic_t *characteristic;
+} get_characteristic_id_t;
+
 void write_characteristic_error(json_stream *json, uint32_t aid, uint32_t iid, int status) {
 	json_object_start(json);
-	json_string(json, "aid");
+	json_key(json, "aid");
 	json_uint32(json, aid);
-	json_string(json, "iid");
+	json_key(json, "iid");
 	json_uint32(json, iid);
-	json_string(json, "status");
+	json_key(json, "status");
 	json_uint8(json, status);
 	json_object_end(json);
 }
@@ -1909,75 +2626,82 @@ void homekit_server_on_get_characteristics(client_context_t *context) {
 	if (bool_endpoint_param("ev", context))
 		format = (characteristic_format_t) (format | characteristic_format_events);
 
-	bool success = true;
+	// Resolve the ids once, up to HOMEKIT_GET_CHARACTERISTICS_IDS on the stack
+	const char *id = id_param->value;
+	size_t ids_count = 1;
+	for (const char *c = id; *c; c++) {
+		if (*c == ',')
+			ids_count++;
+	}
 
-	char *id = strdup(id_param->value);
-	char *ch_id;
-	char *_id = id;
-	while ((ch_id = strsep(&_id, ","))) {
-		char *dot = strstr(ch_id, ".");
-		if (!dot) {
-			send_json_error_response(context, 400, HAPStatus_InvalidValue);
-			free(id);
+	get_characteristic_id_t ids_buffer[HOMEKIT_GET_CHARACTERISTICS_IDS];
+	get_characteristic_id_t *ids = ids_buffer;
+	if (ids_count > HOMEKIT_GET_CHARACTERISTICS_IDS) {
+		ids = (get_characteristic_id_t*) arena_alloc(&context->arena,
+				ids_count * sizeof(get_characteristic_id_t));
+		if (!ids) {
+			CLIENT_ERROR(context, "Failed to allocate %d characteristic ids", (int) ids_count);
+			send_json_error_response(context, 500, HAPStatus_OutOfResources);
 			return;
 		}
+	}
 
-		*dot = 0;
-		uint32_t aid = atoi(ch_id);
-		uint32_t iid = atoi(dot + 1);
-
-		CLIENT_DEBUG(context, "Requested characteristic info for %u.%u", aid, iid);
-		homekit_characteristic_t *ch = homekit_characteristic_by_aid_and_iid(
-				context->server->config->accessories, aid, iid);
-		if (!ch) {
-			success = false;
-			continue;
+	bool success = true;
+	for (size_t i = 0; i < ids_count; i++) {
+		char *end;
+		ids[i].aid = strtoul(id, &end, 10);
+		if (*end != '.') {
+			send_json_error_response(context, 400, HAPStatus_InvalidValue);
+			return;
 		}
+		ids[i].iid = strtoul(end + 1, &end, 10);
+		id = strchr(end, ',');
+		if (id)
+			id++;
+		else
+			id = end; // the last id
 
-		if (!(ch->permissions & homekit_permissions_paired_read)) {
+		CLIENT_DEBUG(context, "Requested characteristic info for %u.%u", ids[i].aid, ids[i].iid);
+		homekit_characteristic_t *ch = homekit_characteristic_by_aid_and_iid(
+				context->server->config->accessories, ids[i].aid, ids[i].iid);
+		ids[i].characteristic = ch;
+		if (!ch || !(ch->permissions & homekit_permissions_paired_read)) {
 			success = false;
-			continue;
 		}
 	}
 
-	free(id);
-	id = strdup(id_param->value);
+	json_stream *json = client_json_new(context, client_send_chunk);
+	if (!json) {
+		send_json_error_response(context, 500, HAPStatus_OutOfResources);
+		return;
+	}
 
 	if (success) {
-		client_send_P(context, json_200_response_headers_progmem);
+		client_write_P(context, json_200_response_headers_progmem);
 	} else {
-		client_send_P(context, json_207_response_headers_progmem);
+		client_write_P(context, json_207_response_headers_progmem);
 	}
 
-	json_stream *json = json_new(HOMEKIT_JSONBUFFER_SIZE, client_send_chunk, context);
 	json_object_start(json);
-	json_string(json, "characteristics");
+	json_key(json, "characteristics");
 	json_array_start(json);
 
-	_id = id;
-	while ((ch_id = strsep(&_id, ","))) {
-		char *dot = strstr(ch_id, ".");
-		*dot = 0;
-		uint32_t aid = atoi(ch_id);
-		uint32_t iid = atoi(dot + 1);
-
-		CLIENT_DEBUG(context, "Requested characteristic info for %d.%d", aid, iid);
-		homekit_characteristic_t *ch = homekit_characteristic_by_aid_and_iid(
-				context->server->config->accessories, aid, iid);
+	for (size_t i = 0; i < ids_count; i++) {
+		homekit_characteristic_t *ch = ids[i].characteristic;
 		if (!ch) {
-			write_characteristic_error(json, aid, iid, HAPStatus_NoResource);
+			write_characteristic_error(json, ids[i].aid, ids[i].iid, HAPStatus_NoResource);
 			continue;
 		}
 
 		if (!(ch->permissions & homekit_permissions_paired_read)) {
-			write_characteristic_error(json, aid, iid, HAPStatus_WriteOnly);
+			write_characteristic_error(json, ids[i].aid, ids[i].iid, HAPStatus_WriteOnly);
 			continue;
 		}
 
 		json_object_start(json);
 		write_characteristic_json(json, context, ch, format, NULL);
 		if (!success) {
-			json_string(json, "status");
+			json_key(json, "status");
 			json_uint8(json, HAPStatus_Success);
 		}
 		json_object_end(json);
@@ -1987,36 +2711,41 @@ void homekit_server_on_get_characteristics(client_context_t *context) {
 	json_object_end(json); // response
 
 	json_flush(json);
-	json_free(json);
 
 	client_send_chunk(NULL, 0, context);
-
-	free(id);
 }
 
-HAPStatus process_characteristics_update(const cJSON *j_ch, client_context_t *context) {
-	cJSON *j_aid = cJSON_GetObjectItem(j_ch, "aid");
-	if (!j_aid) {
-		CLIENT_ERROR(context, "Failed to process request: no \"aid\" field");
-		return HAPStatus_NoResource;
+// Elements of PUT /characteristics kept on the stack, more are allocated in the arena
+#define HOMEKIT_UPDATE_CHARACTERISTICS_WRITES 4
+
+// One element of the "characteristics" array of PUT /characteristics
+typedef struct {
+	uint32_t aid;
+	uint32_t iid;
+	bool has_aid;
+	bool has_iid;
+	bool invalid_id;  // aid or iid is not an integer in the uint32_t range
+	json_token value; // JSON_TOKEN_END if absent
+	json_token ev;    // JSON_TOKEN_END if absent
+	HAPStatus status; // set once the write is applied
+} characteristic_write_t;
+
+HAPStatus process_characteristics_update(const characteristic_write_t *write, client_context_t *context) {
+	if (write->invalid_id) {
+		CLIENT_ERROR(context, "Failed to process request: invalid \"aid\" or \"iid\" field");
+		return HAPStatus_InvalidValue;
 	}
-	if (j_aid->type != cJSON_Number) {
-		CLIENT_ERROR(context, "Failed to process request: \"aid\" field is not a number");
+	if (!write->has_aid) {
+		CLIENT_ERROR(context, "Failed to process request: no \"aid\" field");
 		return HAPStatus_NoResource;
 	}
-
-	cJSON *j_iid = cJSON_GetObjectItem(j_ch, "iid");
-	if (!j_iid) {
+	if (!write->has_iid) {
 		CLIENT_ERROR(context, "Failed to process request: no \"iid\" field");
 		return HAPStatus_NoResource;
 	}
-	if (j_iid->type != cJSON_Number) {
-		CLIENT_ERROR(context, "Failed to process request: \"iid\" field is not a number");
-		return HAPStatus_NoResource;
-	}
 
-	uint32_t aid = (uint32_t)j_aid->valuedouble;//j_aid->valueint;
-	uint32_t iid = (uint32_t)j_iid->valuedouble;//j_iid->valueint;
+	uint32_t aid = write->aid;
+	uint32_t iid = write->iid;
 
 	homekit_characteristic_t *ch = homekit_characteristic_by_aid_and_iid(
 			context->server->config->accessories, aid, iid);
@@ -2026,8 +2755,8 @@ HAPStatus process_characteristics_update(const cJSON *j_ch, client_context_t *co
 		return HAPStatus_NoResource;
 	}
 
-	cJSON *j_value = cJSON_GetObjectItem(j_ch, "value");
-	if (j_value) {
+	const json_token *j_value = &write->value;
+	if (j_value->type != JSON_TOKEN_END) {
 		homekit_value_t h_value = HOMEKIT_NULL_CPP();
 
 		if (!(ch->permissions & homekit_permissions_paired_write)) {
@@ -2038,13 +2767,13 @@ HAPStatus process_characteristics_update(const cJSON *j_ch, client_context_t *co
 		switch (ch->format) {
 		case homekit_format_bool: {
 			bool value = false;
-			if (j_value->type == cJSON_True) {
+			if (j_value->type == JSON_TOKEN_TRUE) {
 				value = true;
-			} else if (j_value->type == cJSON_False) {
+			} else if (j_value->type == JSON_TOKEN_FALSE) {
 				value = false;
-			} else if (j_value->type == cJSON_Number
-					&& (j_value->valueint == 0 || j_value->valueint == 1)) {
-				value = j_value->valueint == 1;
+			} else if (j_value->type == JSON_TOKEN_NUMBER
+					&& (j_value->number == 0 || j_value->number == 1)) {
+				value = j_value->number == 1;
 			} else {
 				CLIENT_ERROR(context, "Failed to update %d.%d: value is not a boolean or 0/1", aid,
 						iid);
@@ -2067,8 +2796,8 @@ HAPStatus process_characteristics_update(const cJSON *j_ch, client_context_t *co
 			case homekit_format_uint64:
 			case homekit_format_int: {
 			// We accept boolean values here in order to fix a bug in HomeKit. HomeKit sometimes sends a boolean instead of an integer of value 0 or 1.
-			if (j_value->type != cJSON_Number && j_value->type != cJSON_False
-					&& j_value->type != cJSON_True) {
+			if (j_value->type != JSON_TOKEN_NUMBER && j_value->type != JSON_TOKEN_FALSE
+					&& j_value->type != JSON_TOKEN_TRUE) {
 				CLIENT_ERROR(context, "Failed to update %d.%d: value is not a number", aid, iid);
 				return HAPStatus_InvalidValue;
 			}
@@ -2113,7 +2842,8 @@ HAPStatus process_characteristics_update(const cJSON *j_ch, client_context_t *co
 			if (ch->max_value)
 				max_value = *ch->max_value;
 
-			double value = j_value->valuedouble;
+			double value = (j_value->type == JSON_TOKEN_NUMBER) ? j_value->number :
+					(j_value->type == JSON_TOKEN_TRUE) ? 1 : 0;
 			if (value < min_value || value > max_value) {
 				CLIENT_ERROR(context, "Failed to update %d.%d: value %g is not in range %g..%g",
 						aid, iid, value, min_value, max_value);
@@ -2187,12 +2917,12 @@ HAPStatus process_characteristics_update(const cJSON *j_ch, client_context_t *co
 			break;
 		}
 		case homekit_format_float: {
-			if (j_value->type != cJSON_Number) {
+			if (j_value->type != JSON_TOKEN_NUMBER) {
 				CLIENT_ERROR(context, "Failed to update %d.%d: value is not a number", aid, iid);
 				return HAPStatus_InvalidValue;
 			}
 
-			float value = j_value->valuedouble;
+			float value = j_value->number;
 			if ((ch->min_value && value < *ch->min_value)
 					|| (ch->max_value && value > *ch->max_value)) {
 				CLIENT_ERROR(context, "Failed to update %d.%d: value is not in range", aid, iid);
@@ -2210,15 +2940,15 @@ HAPStatus process_characteristics_update(const cJSON *j_ch, client_context_t *co
 			break;
 		}
 		case homekit_format_string: {
-			if (j_value->type != cJSON_String) {
+			if (j_value->type != JSON_TOKEN_STRING) {
 				CLIENT_ERROR(context, "Failed to update %d.%d: value is not a string", aid, iid);
 				return HAPStatus_InvalidValue;
 			}
 
-			int max_len = (ch->max_len) ? *ch->max_len : 64;
+			size_t max_len = (ch->max_len) ? *ch->max_len : 64;
 
-			char *value = j_value->valuestring;
-			if (strlen(value) > max_len) {
+			char *value = j_value->string;
+			if (j_value->length > max_len) {
 				CLIENT_ERROR(context, "Failed to update %d.%d: value is too long", aid, iid);
 				return HAPStatus_InvalidValue;
 			}
@@ -2235,15 +2965,15 @@ HAPStatus process_characteristics_update(const cJSON *j_ch, client_context_t *co
 			break;
 		}
 		case homekit_format_tlv: {
-			if (j_value->type != cJSON_String) {
+			if (j_value->type != JSON_TOKEN_STRING) {
 				CLIENT_ERROR(context, "Failed to update %d.%d: value is not a string", aid, iid);
 				return HAPStatus_InvalidValue;
 			}
 
-			int max_len = (ch->max_len) ? *ch->max_len : 256;
+			size_t max_len = (ch->max_len) ? *ch->max_len : 256;
 
-			char *value = j_value->valuestring;
-			size_t value_len = strlen(value);
+			char *value = j_value->string;
+			size_t value_len = j_value->length;
 			if (value_len > max_len) {
 				CLIENT_ERROR(context, "Failed to update %d.%d: value is too long", aid, iid);
 				return HAPStatus_InvalidValue;
@@ -2285,17 +3015,17 @@ HAPStatus process_characteristics_update(const cJSON *j_ch, client_context_t *co
 			break;
 		}
 		case homekit_format_data: {
-			if (j_value->type != cJSON_String) {
+			if (j_value->type != JSON_TOKEN_STRING) {
 				CLIENT_ERROR(context, "Failed to update %d.%d: value is not a string", aid, iid);
 				return HAPStatus_InvalidValue;
 			}
 
 			// Default max data len = 2,097,152 but that does not make sense
 			// for this accessory
-			int max_len = (ch->max_data_len) ? *ch->max_data_len : 4096;
+			size_t max_len = (ch->max_data_len) ? *ch->max_data_len : 4096;
 
-			char *value = j_value->valuestring;
-			size_t value_len = strlen(value);
+			char *value = j_value->string;
+			size_t value_len = j_value->length;
 			if (value_len > max_len) {
 				CLIENT_ERROR(context, "Failed to update %d.%d: value is too long", aid, iid);
 				return HAPStatus_InvalidValue;
@@ -2333,75 +3063,174 @@ HAPStatus process_characteristics_update(const cJSON *j_ch, client_context_t *co
 		}
 	}
 
-	cJSON *j_events = cJSON_GetObjectItem(j_ch, "ev");
-	if (j_events) {
-		if (!(ch->permissions && homekit_permissions_notify)) {
+	const json_token *j_events = &write->ev;
+	if (j_events->type != JSON_TOKEN_END) {
+		if (!(ch->permissions & homekit_permissions_notify)) {
 			CLIENT_ERROR(context,
 					"Failed to set notification state for %d.%d: " "notifications are not supported",
 					aid, iid);
 			return HAPStatus_NotificationsUnsupported;
 		}
 
-		if ((j_events->type != cJSON_True) && (j_events->type != cJSON_False)) {
+		if ((j_events->type != JSON_TOKEN_TRUE) && (j_events->type != JSON_TOKEN_FALSE)) {
 			CLIENT_ERROR(context,
 					"Failed to set notification state for %d.%d: " "invalid state value", aid, iid);
 		}
 
-		if (j_events->type == cJSON_True) {
-			homekit_characteristic_add_notify_callback(ch, client_notify_characteristic, context);
+		int slot = server_characteristic_slot(context->server, ch);
+		if (slot < 0) {
+			CLIENT_ERROR(context,
+					"Failed to set notification state for %d.%d: " "unknown characteristic", aid, iid);
+			return HAPStatus_NoResource;
+		}
+
+		uint8_t *subscribers = &context->server->subscribers[slot];
+		uint8_t bit = 1 << context->index;
+		if (j_events->type == JSON_TOKEN_TRUE) {
+			if (!(*subscribers & bit)) {
+				*subscribers |= bit;
+				context->subscriptions_count++;
+			}
 		} else {
-			homekit_characteristic_remove_notify_callback(ch, client_notify_characteristic,
-					context);
+			if (*subscribers & bit) {
+				*subscribers &= ~bit;
+				context->subscriptions_count--;
+			}
+			BITMAP_CLEAR(context->events, slot);
 		}
 	}
 
 	return HAPStatus_Success;
 }
 
+// A JSON number as an aid or iid: an integer in the uint32_t range
+static bool parse_characteristic_id(double number, uint32_t *id) {
+	if (!(number >= 0 && number <= UINT32_MAX))
+		return false;
+	*id = (uint32_t) number;
+	return *id == number;
+}
+
+// Reads one {"aid":..,"iid":..,"value":..,"ev":..} object, the "{" is already read.
+// authData, remote and r are accepted and ignored.
+bool parse_characteristic_write(json_parser *parser, characteristic_write_t *write) {
+	memset(write, 0, sizeof(*write));
+	write->value.type = JSON_TOKEN_END;
+	write->ev.type = JSON_TOKEN_END;
+
+	json_token key;
+	while (json_parser_next(parser, &key) == JSON_TOKEN_STRING) {
+		json_token value;
+		json_parser_next(parser, &value);
+
+		if (!strcmp(key.string, "aid") && value.type == JSON_TOKEN_NUMBER) {
+			if (!parse_characteristic_id(value.number, &write->aid))
+				write->invalid_id = true;
+			write->has_aid = true;
+		} else if (!strcmp(key.string, "iid") && value.type == JSON_TOKEN_NUMBER) {
+			if (!parse_characteristic_id(value.number, &write->iid))
+				write->invalid_id = true;
+			write->has_iid = true;
+		} else if (!strcmp(key.string, "value")) {
+			write->value = value;
+		} else if (!strcmp(key.string, "ev")) {
+			write->ev = value;
+		}
+
+		if (!json_parser_skip(parser, &value))
+			return false;
+	}
+	return key.type == JSON_TOKEN_OBJECT_END;
+}
+
 void homekit_server_on_update_characteristics(client_context_t *context, const byte *data,
 		size_t size) {
 	DEBUG_TIME_BEGIN();
 	CLIENT_INFO(context, "Update Characteristics");DEBUG_HEAP();
 
-	char *data1 = strndup((char*) data, size);
-	cJSON *json = cJSON_Parse(data1);
-	free(data1);
+	// The body is parsed in place (context->body, which may be the input frame)
+	json_parser parser;
+	json_parser_init(&parser, (char*) data, size);
 
-	if (!json) {
-		CLIENT_ERROR(context, "Failed to parse request JSON");
-		send_json_error_response(context, 400, HAPStatus_InvalidValue);
-		return;
+	json_token token;
+	bool found = false;
+	if (json_parser_next(&parser, &token) == JSON_TOKEN_OBJECT_START) {
+		while (json_parser_next(&parser, &token) == JSON_TOKEN_STRING) {
+			if (!strcmp(token.string, "characteristics")) {
+				found = true;
+				break;
+			}
+			// skip the value of an unknown key
+			if (json_parser_next(&parser, &token) == JSON_TOKEN_ERROR
+					|| !json_parser_skip(&parser, &token)) {
+				break;
+			}
+		}
 	}
-
-	cJSON *characteristics = cJSON_GetObjectItem(json, "characteristics");
-	if (!characteristics) {
+	if (!found) {
 		CLIENT_ERROR(context, "Failed to parse request: no \"characteristics\" field");
-		cJSON_Delete(json);
 		send_json_error_response(context, 400, HAPStatus_InvalidValue);
 		return;
 	}
-	if (characteristics->type != cJSON_Array) {
+	if (json_parser_next(&parser, &token) != JSON_TOKEN_ARRAY_START) {
 		CLIENT_ERROR(context, "Failed to parse request: \"characteristics\" field is not an list");
-		cJSON_Delete(json);
 		send_json_error_response(context, 400, HAPStatus_InvalidValue);
 		return;
 	}
 
-	HAPStatus *statuses = (HAPStatus*) malloc(
-			sizeof(HAPStatus) * cJSON_GetArraySize(characteristics));
-	bool has_errors = false;
-
-	for (int i = 0; i < cJSON_GetArraySize(characteristics); i++) {
-
-		cJSON *j_ch = cJSON_GetArrayItem(characteristics, i);
+	// The whole body is parsed before any write is applied, so that a malformed request
+	// changes nothing. The tokens of the writes point into the body parsed in place.
+	characteristic_write_t writes_buffer[HOMEKIT_UPDATE_CHARACTERISTICS_WRITES];
+	characteristic_write_t *writes = writes_buffer;
+	size_t writes_size = HOMEKIT_UPDATE_CHARACTERISTICS_WRITES;
+	size_t count = 0;
+
+	while (json_parser_next(&parser, &token) == JSON_TOKEN_OBJECT_START) {
+		if (count == writes_size) {
+			characteristic_write_t *w = (characteristic_write_t*) arena_realloc(
+					&context->arena, writes != writes_buffer ? writes : NULL,
+					count * sizeof(characteristic_write_t),
+					2 * writes_size * sizeof(characteristic_write_t));
+			if (!w) {
+				CLIENT_ERROR(context, "Failed to allocate the writes of the request");
+				send_json_error_response(context, 500, HAPStatus_OutOfResources);
+				return;
+			}
+			if (writes == writes_buffer)
+				memcpy(w, writes, count * sizeof(characteristic_write_t));
+			writes = w;
+			writes_size *= 2;
+		}
 
-		char *s = cJSON_Print(j_ch);
-		CLIENT_DEBUG(context, "Processing element %s", s);
-		free(s);
+		if (!parse_characteristic_write(&parser, &writes[count])) {
+			token.type = JSON_TOKEN_ERROR;
+			break;
+		}
+		count++;
+	}
 
-		statuses[i] = process_characteristics_update(j_ch, context);
+	// The rest of the body, other members of the top level object, has to be well-formed too
+	if (token.type == JSON_TOKEN_ARRAY_END) {
+		json_token rest;
+		while (json_parser_next(&parser, &rest) == JSON_TOKEN_STRING) {
+			json_parser_next(&parser, &rest);
+			if (!json_parser_skip(&parser, &rest))
+				break;
+		}
+		if (rest.type != JSON_TOKEN_OBJECT_END || json_parser_next(&parser, &rest) != JSON_TOKEN_END)
+			token.type = JSON_TOKEN_ERROR;
+	}
+	if (token.type != JSON_TOKEN_ARRAY_END) {
+		CLIENT_ERROR(context, "Failed to parse request JSON");
+		send_json_error_response(context, 400, HAPStatus_InvalidValue);
+		return;
+	}
 
-		if (statuses[i] != HAPStatus_Success)
+	bool has_errors = false;
+	for (size_t i = 0; i < count; i++) {
+		CLIENT_DEBUG(context, "Processing element %u.%u", writes[i].aid, writes[i].iid);
+		writes[i].status = process_characteristics_update(&writes[i], context);
+		if (writes[i].status != HAPStatus_Success)
 			has_errors = true;
 	}
 
@@ -2411,24 +3240,25 @@ void homekit_server_on_update_characteristics(client_context_t *context, const b
 		send_204_response(context);
 	} else {
 		CLIENT_DEBUG(context, "There were processing errors, sending Multi-Status response");
-		client_send_P(context, json_207_response_headers_progmem);
+		json_stream *json1 = client_json_new(context, client_send_chunk);
+		if (!json1) {
+			send_json_error_response(context, 500, HAPStatus_OutOfResources);
+			return;
+		}
+		client_write_P(context, json_207_response_headers_progmem);
 
-		json_stream *json1 = json_new(HOMEKIT_JSONBUFFER_SIZE, client_send_chunk, context);
 		json_object_start(json1);
-		json_string(json1, "characteristics");
+		json_key(json1, "characteristics");
 		json_array_start(json1);
 
-		for (int i = 0; i < cJSON_GetArraySize(characteristics); i++) {
-
-			cJSON *j_ch = cJSON_GetArrayItem(characteristics, i);
-
+		for (size_t i = 0; i < count; i++) {
 			json_object_start(json1);
-			json_string(json1, "aid");
-			json_uint32(json1, cJSON_GetObjectItem(j_ch, "aid")->valuedouble);//->valueint);
-			json_string(json1, "iid");
-			json_uint32(json1, cJSON_GetObjectItem(j_ch, "iid")->valuedouble);//->valueint);
-			json_string(json1, "status");
-			json_uint8(json1, statuses[i]);
+			json_key(json1, "aid");
+			json_uint32(json1, writes[i].aid);
+			json_key(json1, "iid");
+			json_uint32(json1, writes[i].iid);
+			json_key(json1, "status");
+			json_uint8(json1, writes[i].status);
 			json_object_end(json1);
 		}
 
@@ -2436,13 +3266,10 @@ void homekit_server_on_update_characteristics(client_context_t *context, const b
 		json_object_end(json1); // response
 
 		json_flush(json1);
-		json_free(json1);
 
 		client_send_chunk(NULL, 0, context);
 	}
 
-	free(statuses);
-	cJSON_Delete(json);
 	DEBUG_TIME_END("update_characteristics");
 }
 
@@ -2734,9 +3561,11 @@ int homekit_server_on_url(http_parser *parser, const char *data, size_t length)
 					&& (data[url_len] == 0 || data[url_len] == '?')) {
 				context->endpoint = HOMEKIT_ENDPOINT_GET_CHARACTERISTICS;
 				if (data[url_len] == '?') {
-					char *query = strndup(data + url_len + 1, length - url_len - 1);
-					context->endpoint_params = query_params_parse(query);
-					free(query);
+					char *query = arena_strndup(&context->arena, data + url_len + 1,
+							length - url_len - 1);
+					if (query)
+						context->endpoint_params = query_params_parse_in_place(query,
+								&context->arena);
 				}
 			}
 		}
@@ -2759,10 +3588,8 @@ int homekit_server_on_url(http_parser *parser, const char *data, size_t length)
 	}
 
 	if (context->endpoint == HOMEKIT_ENDPOINT_UNKNOWN) {
-		char *url = strndup(data, length);
 		//TODO fix
-		//ERROR("Unknown endpoint: %s %s", http_method_str(parser->method), url);
-		free(url);
+		//ERROR("Unknown endpoint: %s %.*s", http_method_str(parser->method), length, data);
 	}
 
 	return 0;
@@ -2771,7 +3598,38 @@ int homekit_server_on_url(http_parser *parser, const char *data, size_t length)
 int homekit_server_on_body(http_parser *parser, const char *data, size_t length) {
 	DEBUG("http_parser lenght=%d", length);
 	client_context_t *context = (client_context_t*) parser->data;
-	context->body = (char*) realloc(context->body, context->body_length + length + 1);
+	bool chunked = parser->flags & F_CHUNKED;
+
+	// parser->content_length is what remains of the body after this data
+	if (!context->body && !chunked && !parser->content_length
+			&& context->endpoint != HOMEKIT_ENDPOINT_RESOURCE) {
+		// The whole body is in this input, which is kept until on_message_complete:
+		// no copy. It is not NUL-terminated since the next request may follow.
+		// (config->on_resource gets a NUL-terminated copy)
+		context->body = (char*) data;
+		context->body_length = length;
+		return 0;
+	}
+
+	if (!context->body || chunked) {
+		// Allocated once for the Content-Length, grown for each chunk otherwise
+		if (parser->content_length > HOMEKIT_MAX_BODY_SIZE
+				|| context->body_length + length > HOMEKIT_MAX_BODY_SIZE) {
+			CLIENT_ERROR(context, "The body is too large");
+			return -1;
+		}
+		size_t size = context->body_length + length + 1;
+		if (!chunked)
+			size += parser->content_length;
+
+		char *body = (char*) arena_realloc(&context->arena, context->body,
+				context->body ? context->body_length + 1 : 0, size);
+		if (!body) {
+			CLIENT_ERROR(context, "Failed to allocate the body of %d bytes", (int) (size - 1));
+			return -1;
+		}
+		context->body = body;
+	}
 	memcpy(context->body + context->body_length, data, length);
 	context->body_length += length;
 	context->body[context->body_length] = 0;
@@ -2783,6 +3641,14 @@ int homekit_server_on_message_complete(http_parser *parser) {
 	DEBUG("http_parser message_complete");
 	client_context_t *context = (client_context_t*) parser->data;
 
+	if (context->accessories_json) {
+		// Sent along with the request before: its response would be interleaved
+		CLIENT_ERROR(context, "Request received before the previous response was sent");
+		context->error_write = true;
+		context->disconnect = true;
+		return 0;
+	}
+
 	if (!context->encrypted) {
 		switch (context->endpoint) {
 		case HOMEKIT_ENDPOINT_PAIR_SETUP: {
@@ -2836,16 +3702,13 @@ int homekit_server_on_message_complete(http_parser *parser) {
 		}
 	}
 
-	if (context->endpoint_params) {
-		query_params_free(context->endpoint_params);
-		context->endpoint_params = NULL;
-	}
-
-	if (context->body) {
-		free(context->body);
-		context->body = NULL;
-		context->body_length = 0;
-	}
+	// Release the body, the query params and the response of this request
+	// (a response still being written is released by client_send_accessories)
+	context->endpoint_params = NULL;
+	context->body = NULL;
+	context->body_length = 0;
+	if (!context->accessories_json)
+		arena_reset(&context->arena);
 	return 0;
 }
 
@@ -2869,16 +3732,22 @@ http_parser_settings make_http_parser_settings() {
 //struct A a={b:1,c:2}；
 static http_parser_settings homekit_http_parser_settings = make_http_parser_settings();
 
-void homekit_client_process(client_context_t *context) {
+void client_parse(client_context_t *context, byte *data, size_t size) {
+	current_client_context = context;
+	http_parser_execute(&context->parser, &homekit_http_parser_settings, (char*) data, size);
+	current_client_context = NULL;
+
+	CLIENT_DEBUG(context, "Finished processing");
+}
+
+// Reads what fits in context->data and handles it. Returns the size read,
+// or -1 if the client is closed (and freed).
+int client_receive(client_context_t *context) {
 //    int data_len = read(
 //        context->socket,
 //        context->data+context->data_available,
 //        context->data_size-context->data_available
 //    );
-	if (context->socket == nullptr) {
-		CLIENT_ERROR(context, "The socket is null");
-		return;
-	}
 	int data_len = 0;
 	int available_len = context->socket->available();  // optimistic_yield(100);
 	if (available_len > 0) {
@@ -2889,58 +3758,93 @@ void homekit_client_process(client_context_t *context) {
 		// read or readBytes
 		data_len = context->socket->read(context->data + context->data_available, size);
 	}
-	if (data_len == 0) {
-		if (!context->socket->connected()) {
-			CLIENT_INFO(context, "Disconnected!");
-			context->disconnect = true;
-			homekit_server_close_client(context->server, context);
-		}
-		return;
-	}
+	if (data_len <= 0)
+		return 0;
+
 	CLIENT_DEBUG(context, "Got %d incomming data, encrypted is %s",
 			data_len, context->encrypted ? "true" : "false");
-	byte *payload = (byte*) context->data;
-	size_t payload_size = (size_t) data_len;
-
-	byte *decrypted = NULL;
-	size_t decrypted_size = 0;
-
-	if (context->encrypted) {
-		CLIENT_DEBUG(context, "Decrypting data");
+	context->data_available += data_len;
 
-		client_decrypt_(context, context->data, data_len, NULL, &decrypted_size);
-
-		decrypted = (byte*) malloc(decrypted_size);
-		int r = client_decrypt_(context, context->data, data_len, decrypted, &decrypted_size);
+	if (!context->encrypted) {
+		size_t size = context->data_available;
+		context->data_available = 0;
+		client_parse(context, context->data, size);
+		return data_len;
+	}
 
+	// Each complete frame is decrypted in place and its plaintext is parsed from there,
+	// a partial frame is moved to the start of context->data for the next read
+	size_t offset = 0;
+	while (offset < context->data_available) {
+		size_t payload_size;
+		int r = client_decrypt_frame(context, context->data + offset,
+				context->data_available - offset, &payload_size);
 		if (r < 0) {
 			CLIENT_ERROR(context, "Invalid client data");
-			free(decrypted);
-			return;
-		}
-		context->data_available = data_len - r;
-		if (r && context->data_available) {
-			memmove(context->data, &context->data[r], context->data_available);
+			homekit_server_close_client(context->server, context);
+			return -1;
 		}
-		CLIENT_DEBUG(context, "Decrypted %d bytes, available %d", decrypted_size, context->data_available);
+		if (!r)
+			break;
 
-		payload = decrypted;
-		payload_size = decrypted_size;
+		byte *payload = context->data + offset + 2;
+		offset += r;
+		CLIENT_DEBUG(context, "Decrypted %d bytes, available %d", payload_size,
+				context->data_available - offset);
 		if (payload_size)
 			print_binary("Decrypted data", payload, payload_size);
-	} else {
-		context->data_available = 0;
+
+		client_parse(context, payload, payload_size);
 	}
 
-	current_client_context = context;
-	http_parser_execute(&context->parser, &homekit_http_parser_settings,
-			(char*) payload, payload_size);
-	current_client_context = NULL;
+	context->data_available -= offset;
+	if (offset && context->data_available) {
+		memmove(context->data, context->data + offset, context->data_available);
+	}
+	return data_len;
+}
 
-	CLIENT_DEBUG(context, "Finished processing");
+void homekit_client_process(client_context_t *context) {
+	if (context->socket == nullptr) {
+		CLIENT_ERROR(context, "The socket is null");
+		return;
+	}
+
+	client_output_drain(context);
+	if (context->error_write || (context->disconnect && !context->output_length)) {
+		// Failed to write, or asked to close once the response is sent (pairing removed)
+		homekit_server_close_client(context->server, context);
+		return;
+	}
+
+	if (context->accessories_json) {
+		if (!context->socket->connected()) {
+			CLIENT_INFO(context, "Disconnected!");
+			context->disconnect = true;
+			homekit_server_close_client(context->server, context);
+			return;
+		}
+		if (context->output_length < HOMEKIT_OUTPUT_RESUME_SIZE)
+			client_send_accessories(context);
+		if (context->accessories_json)
+			return; // the next request waits for the end of this response
+	}
+
+	int data_len = client_receive(context);
+	if (data_len == 0) {
+		if (!context->socket->connected()) {
+			CLIENT_INFO(context, "Disconnected!");
+			context->disconnect = true;
+			homekit_server_close_client(context->server, context);
+		}
+		return;
+	}
 
-	if (decrypted) {
-		free(decrypted);
+	// Handle the rest of a request of several frames in this pass, until the input
+	// is drained or the client is to be closed
+	while (data_len > 0 && !context->error_write && !context->disconnect
+			&& !context->accessories_json) {
+		data_len = client_receive(context);
 	}
 }
 
@@ -2949,16 +3853,29 @@ void homekit_server_close_client(homekit_server_t *server, client_context_t *con
 	context->step = HOMEKIT_CLIENT_STEP_END;
 	server->nfds--;
 
+	if (server->frame_client == context) {
+		// Drop the unsent output of this client
+		server->frame_size = 0;
+		server->frame_client = NULL;
+	}
+
 	if (context->socket) {
 		context->socket->stop();
 		CLIENT_DEBUG(context, "The sockect is stopped");
 		delete context->socket;
 		context->socket = nullptr;
 	}
-	if (context->server->pairing_context && context->server->pairing_context->client == context) {
-		pairing_context_free(context->server->pairing_context);
+	pairing_context_t *pairing_context = context->server->pairing_context;
+	if (pairing_context && pairing_context->client == context) {
 		context->server->pairing_context = NULL;
-		CLIENT_INFO(context, "Clear the pairing context");
+		if (pairing_context->srp_state == PAIRING_SRP_INIT
+				|| pairing_context->srp_state == PAIRING_SRP_PUBLIC_KEY) {
+			// M2 was not sent yet, the preinit goes on for the next Pair Setup
+			pairing_context->client = NULL;
+		} else {
+			pairing_context_free(pairing_context);
+			CLIENT_INFO(context, "Clear the pairing context");
+		}
 	}
 
 	if (context->server->clients == context) {
@@ -2971,8 +3888,15 @@ void homekit_server_close_client(homekit_server_t *server, client_context_t *con
 			c->next = c->next->next;
 	}
 
-	homekit_accessories_clear_notify_callbacks(context->server->config->accessories,
-			client_notify_characteristic, context);
+	// Clear the subscriptions of this client, up to the last one
+	uint8_t bit = 1 << context->index;
+	for (size_t slot = 0; context->subscriptions_count && slot < server->characteristics_count;
+			slot++) {
+		if (server->subscribers[slot] & bit) {
+			server->subscribers[slot] &= ~bit;
+			context->subscriptions_count--;
+		}
+	}
 
 	HOMEKIT_NOTIFY_EVENT(server, HOMEKIT_EVENT_CLIENT_DISCONNECTED);
 
@@ -3012,6 +3936,19 @@ client_context_t* homekit_server_accept_client(homekit_server_t *server) {
 	client_context_t *context = client_context_new(wifiClient);
 	context->server = server;
 	context->socket = wifiClient;
+	if (!client_events_new(context)) {
+		CLIENT_ERROR(context, "Failed to allocate events");
+		client_context_free(context);
+		return NULL;
+	}
+
+	// The lowest bit of server->subscribers not used by another client
+	uint8_t used = 0;
+	for (client_context_t *c = server->clients; c; c = c->next) {
+		used |= 1 << c->index;
+	}
+	while (used & (1 << context->index))
+		context->index++;
 
 	context->next = server->clients;
 	server->clients = context;
@@ -3025,72 +3962,122 @@ client_context_t* homekit_server_accept_client(homekit_server_t *server) {
 
 //设备向iPhone传递characteristic的消息
 void homekit_server_process_notifications(homekit_server_t *server) {
-	client_context_t *context = server->clients;
-	// 把characteristic_event_t拼接成client_event_t链表
 	// 按照Apple的规定，Nofiy消息需合并发送
+	// (the changes are coalesced by characteristic in context->events)
+	if (!server->events_pending)
+		return;
+
+	uint32_t now = millis();
+	uint16_t min_interval = server->config->event_min_interval;
+	size_t words = BITMAP_WORDS(server->characteristics_count);
+	const uint32_t *mask = NULL;
+	bool round = false;
+
+	client_context_t *context = server->clients;
 	while (context) {
-		if (context->step != HOMEKIT_CLIENT_STEP_PAIR_VERIFY_2OF2) {
-			// Do not send event when the client is not verify over.
+		if (!client_events_due(context, now)) {
+			// Nothing to send, or the client is not verify over.
 			context = context->next;
 			continue;
 		}
-		characteristic_event_t *event = NULL;
-		if (context->event_queue && q_pop(context->event_queue, &event)) {
-			// Get and coalesce all client events
-			client_event_t *events_head = (client_event_t*) malloc(sizeof(client_event_t));
-			events_head->characteristic = event->characteristic;
-			homekit_value_copy(&events_head->value, &event->value);
-			events_head->next = NULL;
-
-			homekit_value_destruct(&event->value);
-			free(event);
-
-			client_event_t *events_tail = events_head;
-
-			while (q_pop(context->event_queue, &event)) {
-				//q_pop第二个参数必须传指针的地址
-				//event = context->event_queue->shift();
-				client_event_t *e = events_head;
-				while (e) {
-					if (e->characteristic == event->characteristic) {
-						break;
-					}
-					e = e->next;
-				}
-
-				if (e) {
-					homekit_value_destruct(&e->value);
-				} else {
-					e = (client_event_t*) malloc(sizeof(client_event_t));
-					e->characteristic = event->characteristic;
-					e->next = NULL;
 
-					events_tail->next = e;
-					events_tail = e;
+		if (!round && server->characteristic_sent_at) {
+			// The characteristics which were not sent within event_min_interval
+			for (size_t i = 0; i < words; i++) {
+				server->events_ready[i] = 0;
+				server->events_sent[i] = 0;
+			}
+			for (size_t slot = 0; slot < server->characteristics_count; slot++) {
+				if ((uint32_t) (now - server->characteristic_sent_at[slot]) >= min_interval)
+					BITMAP_SET(server->events_ready, slot);
+			}
+			mask = server->events_ready;
+		}
+		round = true;
+
+		if (client_events_select(context, mask, server->events_message)) {
+			// Render the message once, then encrypt it for this client and for every
+			// later one which has the same changes to send
+			event_message_t message;
+			if (event_message_render(server, server->events_message, &message)) {
+				send_client_events(context, &message, server->events_message);
+				for (client_context_t *c = context->next; c; c = c->next) {
+					if (client_events_due(c, now)
+							&& client_events_match(c, mask, server->events_message))
+						send_client_events(c, &message, server->events_message);
 				}
+				free(message.data);
 
-				homekit_value_copy(&e->value, &event->value);
-
-				homekit_value_destruct(&event->value);
-				free(event);
+				if (server->events_sent) {
+					for (size_t i = 0; i < words; i++) {
+						server->events_sent[i] |= server->events_message[i];
+					}
+				}
 			}
+		}
 
-			send_client_events(context, events_head);
-
-			client_event_t *e = events_head;
-			while (e) {
-				client_event_t *next = e->next;
-
-				homekit_value_destruct(&e->value);
-				free(e);
+		context = context->next;
+	}
 
-				e = next;
-			}
+	if (round && server->characteristic_sent_at) {
+		for (size_t slot = 0; slot < server->characteristics_count; slot++) {
+			if (BITMAP_GET(server->events_sent, slot))
+				server->characteristic_sent_at[slot] = now;
 		}
+	}
 
-		context = context->next;
+	server->events_pending = false;
+	for (context = server->clients; context; context = context->next) {
+		if (context->events_pending)
+			server->events_pending = true;
+	}
+}
+
+// The milliseconds until a client has work for homekit_server_process, or
+// HOMEKIT_NO_DEADLINE, see arduino_homekit_next_deadline
+uint32_t homekit_client_next_deadline(client_context_t *context, uint32_t now) {
+	if (context->output_length || context->accessories_json || context->error_write
+			|| context->disconnect)
+		return 0;
+	if (context->step != HOMEKIT_CLIENT_STEP_PAIR_VERIFY_2OF2 || !context->events_pending)
+		return HOMEKIT_NO_DEADLINE;
+
+	homekit_server_t *server = context->server;
+	uint32_t deadline = 0;
+	uint16_t batch_window = server->config->event_batch_window;
+	uint32_t elapsed = now - context->events_time;
+	if (elapsed < batch_window)
+		deadline = batch_window - elapsed;
+
+	if (server->characteristic_sent_at) {
+		// Sent once any of the changes is out of event_min_interval
+		uint16_t min_interval = server->config->event_min_interval;
+		uint32_t ready = HOMEKIT_NO_DEADLINE;
+		for (size_t slot = 0; slot < server->characteristics_count && ready; slot++) {
+			if (!BITMAP_GET(context->events, slot))
+				continue;
+			elapsed = now - server->characteristic_sent_at[slot];
+			if (elapsed >= min_interval)
+				ready = 0;
+			else if (min_interval - elapsed < ready)
+				ready = min_interval - elapsed;
+		}
+		if (ready > deadline)
+			deadline = ready;
 	}
+	return deadline;
+}
 
+uint32_t homekit_server_next_deadline(homekit_server_t *server) {
+	uint32_t now = millis();
+	uint32_t deadline = HOMEKIT_NO_DEADLINE;
+	for (client_context_t *context = server->clients; context && deadline;
+			context = context->next) {
+		uint32_t d = homekit_client_next_deadline(context, now);
+		if (d < deadline)
+			deadline = d;
+	}
+	return deadline;
 }
 
 bool homekit_client_need_process_data(client_context_t *context) {
@@ -3101,6 +4088,45 @@ bool homekit_client_need_process_data(client_context_t *context) {
 	return false;
 }
 
+// Steps the SRP computation of the preinit pairing context (the pairing_context of a
+// Pair Setup in progress), and sends the response waiting for it (M2 or M4) once done
+void homekit_server_process_srp(homekit_server_t *server) {
+	pairing_context_t *context = saved_preinit_pairing_context;
+	if (!context || !context->srp_job)
+		return;
+
+	pairing_srp_state_t state = context->srp_state;
+	int r = pairing_context_srp_step(context);
+	if (r > 0)
+		return;
+
+	client_context_t *client = context->client;
+	if (state == PAIRING_SRP_COMPUTE_KEY) {
+		pair_setup_send_m4(client);
+		arena_reset(&client->arena);
+		return;
+	}
+
+	if (r) {
+		ERROR("Failed to initialize SRP (code %d)", r);
+		if (server->pairing_context == context)
+			server->pairing_context = NULL;
+		pairing_context_free(context);
+		if (client) {
+			send_tlv_error_response(client, 2, TLVError_Unknown);
+			arena_reset(&client->arena);
+		}
+		return;
+	}
+
+	INFO("Preinit pairing context success");
+	MDNS.announce();		// update "paired" state
+	if (client) {
+		pair_setup_send_m2(client);
+		arena_reset(&client->arena);
+	}
+}
+
 //run in loop, include {accept_client, client_process, notifications}
 void homekit_server_process(homekit_server_t *server) {
 
@@ -3108,6 +4134,7 @@ void homekit_server_process(homekit_server_t *server) {
 
 	client_context_t *context = server->clients;
 	while (context) {
+		client_context_t *next = context->next;
 		//homekit_client_process includes {handle data and stop disconnected client}
 //		do{
 //			if(homekit_client_need_process_data(context)){
@@ -3117,8 +4144,9 @@ void homekit_server_process(homekit_server_t *server) {
 		homekit_client_process(context);
 //		} while(homekit_client_need_process_data(context));
 
-		context = context->next;
+		context = next;
 	}
+	homekit_server_process_srp(server);
 	homekit_server_process_notifications(server);
 }
 
@@ -3247,7 +4275,6 @@ void homekit_mdns_init(homekit_server_t *server) {
 
 		unsigned char encodedHash[9];
 		memset(encodedHash, 0, sizeof(encodedHash));
-		word32 len = sizeof(encodedHash);
 		base64_encode_((const unsigned char*) shaHash, 4, encodedHash);
 		MDNS.addServiceTxt(mdns_service, "sh", (char*) encodedHash);
 	}
@@ -3263,6 +4290,25 @@ void homekit_mdns_init(homekit_server_t *server) {
 // Call this function when an accessory, service, or characteristic is added or removed on the accessory server.
 // See the official HAP specification for more information.
 void homekit_update_config_number() {
+	if (running_server) {
+		// A GET /accessories response being written would mix the old and the new
+		// accessories, the client is closed and fetches them again
+		for (client_context_t *c = running_server->clients; c; c = c->next) {
+			if (c->accessories_json) {
+				CLIENT_INFO(c, "Accessories changed while they were being sent");
+				c->error_write = true;
+			}
+		}
+	}
+	if (running_server && running_server->accessories_cache) {
+		// The accessories json must be rendered again
+		accessories_cache_free(running_server->accessories_cache);
+		running_server->accessories_cache = NULL;
+	}
+	if (running_server) {
+		// The characteristic slots may have changed
+		server_characteristics_build(running_server);
+	}
 	if(!homekit_mdns_started) {
 		return ;
 	}
@@ -3347,6 +4393,7 @@ void homekit_server_init(homekit_server_config_t *config) {
 	homekit_server_t *server = server_new();
 	running_server = server;
 	server->config = config;
+	server_characteristics_build(server);
 
 	//homekit_server_task(server);
 	INFO("Starting server");
@@ -3489,6 +4536,138 @@ int homekit_get_setup_uri(const homekit_server_config_t *config, char *buffer, s
 	return 0;
 }
 
+// Sets up the SRP of a pairing context for the password and starts computing the
+// server public key (see pairing_context_srp_step), or takes them from the setup kept
+// in flash (HOMEKIT_SRP_CACHE). The verifier is the one of config->setup_verifier if
+// provisioned.
+int pairing_context_srp_init(pairing_context_t *context, const homekit_server_config_t *config,
+		const char *password) {
+	srp_setup_t *setup = NULL;
+	bool setup_valid = false; // the setup in flash is for this password (and verifier)
+	bool key_unused = false;
+	byte password_hash[WC_SHA512_DIGEST_SIZE];
+#if HOMEKIT_SRP_CACHE
+	if (config->password) {
+		setup = (srp_setup_t*) malloc(sizeof(srp_setup_t));
+	}
+#endif
+	if (setup) {
+		wc_Sha512Hash((const byte*) password, strlen(password), password_hash);
+		if (!homekit_storage_load_srp_setup(setup, &key_unused)) {
+			setup_valid = !memcmp(setup->password_hash, password_hash,
+					sizeof(setup->password_hash));
+			if (setup_valid && config->setup_salt && config->setup_verifier) {
+				setup_valid = !memcmp(setup->salt, config->setup_salt, sizeof(setup->salt))
+						&& !memcmp(setup->verifier, config->setup_verifier,
+								sizeof(setup->verifier));
+			}
+		}
+		memcpy(setup->password_hash, password_hash, sizeof(setup->password_hash));
+	}
+
+	int r;
+	if (config->setup_salt && config->setup_verifier) {
+		INFO("Using the provisioned SRP verifier");
+		r = crypto_srp_init_verifier(context->srp, "Pair-Setup", config->setup_salt,
+				sizeof(setup->salt), config->setup_verifier, sizeof(setup->verifier));
+	} else if (setup_valid) {
+		INFO("Using the SRP verifier in flash");
+		r = crypto_srp_init_verifier(context->srp, "Pair-Setup", setup->salt,
+				sizeof(setup->salt), setup->verifier, sizeof(setup->verifier));
+	} else {
+		r = crypto_srp_init_begin(context->srp, "Pair-Setup", password, &context->srp_job);
+		if (!r)
+			context->srp_state = PAIRING_SRP_INIT;
+	}
+	if (r) {
+		ERROR("Failed to initialize SRP (code %d)", r);
+		free(setup);
+		return r;
+	}
+
+	if (context->public_key) {
+		free(context->public_key);
+		context->public_key = NULL;
+	}
+	context->public_key_size = 0;
+	crypto_srp_get_public_key(context->srp, NULL, &context->public_key_size);
+
+	context->public_key = (byte*) malloc(context->public_key_size);
+
+	if (setup_valid && key_unused && context->public_key_size == sizeof(setup->public_key)) {
+		INFO("Using the SRP server key in flash");
+		memcpy(context->public_key, setup->public_key, sizeof(setup->public_key));
+		r = crypto_srp_set_private_key(context->srp, setup->private_key,
+				sizeof(setup->private_key));
+		free(setup);
+		return r;
+	}
+
+	// Kept for the next preinit once the public key is computed
+	context->srp_setup = setup;
+	if (context->srp_state == PAIRING_SRP_INIT) {
+		// The public key after the verifier
+		return 0;
+	}
+
+	r = crypto_srp_get_public_key_begin(context->srp, &context->srp_job);
+	if (!r)
+		context->srp_state = PAIRING_SRP_PUBLIC_KEY;
+	return r;
+}
+
+// Saves the SRP setup of a pairing context in flash (HOMEKIT_SRP_CACHE), for the
+// next preinit
+void pairing_context_srp_save(pairing_context_t *context) {
+	srp_setup_t *setup = context->srp_setup;
+	if (!setup)
+		return;
+
+	size_t salt_size = sizeof(setup->salt);
+	memset(setup->public_key, 0, sizeof(setup->public_key) - context->public_key_size);
+	memcpy(setup->public_key + sizeof(setup->public_key) - context->public_key_size,
+			context->public_key, context->public_key_size);
+	if (!crypto_srp_get_salt(context->srp, setup->salt, &salt_size)
+			&& salt_size == sizeof(setup->salt)
+			&& !crypto_srp_get_verifier(context->srp, setup->verifier, sizeof(setup->verifier))
+			&& !crypto_srp_get_private_key(context->srp, setup->private_key,
+					sizeof(setup->private_key))) {
+		homekit_storage_save_srp_setup(setup);
+	}
+	free(setup);
+	context->srp_setup = NULL;
+}
+
+// Does one step (HOMEKIT_SRP_STEP_OPERATIONS) of the SRP computation of a pairing
+// context. Returns >0 while it is not done, <0 on error. The shared secret of
+// PAIRING_SRP_COMPUTE_KEY is finished by pair_setup_send_m4.
+int pairing_context_srp_step(pairing_context_t *context) {
+	int r = crypto_srp_job_step(context->srp_job, HOMEKIT_SRP_STEP_OPERATIONS);
+	if (r)
+		return r;
+
+	switch (context->srp_state) {
+	case PAIRING_SRP_INIT:
+		r = crypto_srp_init_finish(context->srp, context->srp_job);
+		pairing_context_srp_job_free(context);
+		if (!r)
+			r = crypto_srp_get_public_key_begin(context->srp, &context->srp_job);
+		if (r)
+			return r;
+		context->srp_state = PAIRING_SRP_PUBLIC_KEY;
+		return 1;
+	case PAIRING_SRP_PUBLIC_KEY:
+		r = crypto_srp_get_public_key_finish(context->srp, context->srp_job,
+				context->public_key, &context->public_key_size);
+		pairing_context_srp_job_free(context);
+		if (!r)
+			pairing_context_srp_save(context);
+		return r;
+	default:
+		return 0;
+	}
+}
+
 // Pre-initialize the pairing_context used in Pair-Setep 1/3
 // For avoiding timeout caused sockect disconnection from iOS device.
 bool arduino_homekit_preinit(homekit_server_t *server) {
@@ -3500,7 +4679,8 @@ bool arduino_homekit_preinit(homekit_server_t *server) {
 	DEBUG_HEAP();
 	char password[11];
 	if (server->config->password) {
-		strncpy(password, server->config->password, sizeof(password));
+		strncpy(password, server->config->password, sizeof(password) - 1);
+		password[sizeof(password) - 1] = 0;
 		//CLIENT_DEBUG(context, "Using user-specified password: %s", password);
 		INFO("Using user-specified password: %s", password);
 	} else {
@@ -3517,36 +4697,11 @@ bool arduino_homekit_preinit(homekit_server_t *server) {
 		server->config->password_callback(password);
 	}
 
-	watchdog_disable_all();
-	watchdog_check_begin();
-	crypto_srp_init(preinit_pairing_context->srp, "Pair-Setup", password);
-	watchdog_check_end("crypto_srp_init");  // 6585ms
-	watchdog_enable_all();
-
-	delay(10);
-
-	if (preinit_pairing_context->public_key) {
-		free(preinit_pairing_context->public_key);
-		preinit_pairing_context->public_key = NULL;
-	}
-	preinit_pairing_context->public_key_size = 0;
-	crypto_srp_get_public_key(preinit_pairing_context->srp, NULL,
-			&preinit_pairing_context->public_key_size);
-
-	preinit_pairing_context->public_key = (byte*) malloc(preinit_pairing_context->public_key_size);
-
-	watchdog_disable_all();
-	watchdog_check_begin();
-	int r = crypto_srp_get_public_key(preinit_pairing_context->srp,
-			preinit_pairing_context->public_key, &preinit_pairing_context->public_key_size);
-	watchdog_check_end("crypto_srp_get_public_key");  // 3310ms
-	watchdog_enable_all();
-
-	delay(10);
+	int r = pairing_context_srp_init(preinit_pairing_context, server->config, password);
 
 	if (r) {
 		//CLIENT_ERROR(context, "Failed to dump SPR public key (code %d)", r);
-		ERROR("Failed to dump SPR public key (code %d)");
+		ERROR("Failed to dump SPR public key (code %d)", r);
 		pairing_context_free(preinit_pairing_context);
 		preinit_pairing_context = NULL;
 		// In preinit, we should not send response
@@ -3554,6 +4709,11 @@ bool arduino_homekit_preinit(homekit_server_t *server) {
 		return false;
 	}
 	saved_preinit_pairing_context = preinit_pairing_context;
+	if (preinit_pairing_context->srp_job) {
+		// Computed by homekit_server_process_srp
+		INFO("Computing the SRP setup");
+		return true;
+	}
 
 	INFO("Preinit pairing context success");
 	MDNS.announce();		// update "paired" state
@@ -3595,6 +4755,16 @@ void arduino_homekit_loop() {
 	}
 }
 
+uint32_t arduino_homekit_next_deadline() {
+	if (running_server == nullptr)
+		return HOMEKIT_NO_DEADLINE;
+	if (!running_server->paired && saved_preinit_pairing_context == nullptr)
+		return 0;
+	if (saved_preinit_pairing_context && saved_preinit_pairing_context->srp_job)
+		return 0;
+	return homekit_server_next_deadline(running_server);
+}
+
 int arduino_homekit_connected_clients_count() {
 	if (running_server) {
 		return running_server->nfds;
@@ -16,10 +16,10 @@ extern "C" {
 #include "pairing.h"
 #include "storage.h"
 #include "query_params.h"
+#include "arena.h"
 #include "json.h"
 #include "homekit_debug.h"
 #include "port.h"
-#include "cQueue.h"
 #include "homekit/homekit.h"
 #include "http_parser.h"
 
@@ -50,11 +50,30 @@ typedef enum {
 struct _client_context_t;
 typedef struct _client_context_t client_context_t;
 
+typedef enum {
+	PAIRING_SRP_READY = 0,   // nothing to compute
+	PAIRING_SRP_INIT,        // computing the verifier
+	PAIRING_SRP_PUBLIC_KEY,  // computing the server public key
+	PAIRING_SRP_COMPUTE_KEY, // computing the shared secret of Pair Setup M3
+} pairing_srp_state_t;
+
 typedef struct {
 	Srp *srp;
 	byte *public_key;
 	size_t public_key_size;
 
+	// The SRP computation in progress, stepped from arduino_homekit_loop, see
+	// homekit_server_process_srp. The response to the client waits for it.
+	crypto_srp_job_t *srp_job;
+	pairing_srp_state_t srp_state;
+	// To save in flash once the public key is computed (HOMEKIT_SRP_CACHE)
+	srp_setup_t *srp_setup;
+	// Pair Setup M3, kept until the shared secret is computed
+	byte *device_public_key;
+	size_t device_public_key_size;
+	byte *device_proof;
+	size_t device_proof_size;
+
 	client_context_t *client;
 } pairing_context_t;
 
@@ -69,6 +88,49 @@ typedef struct {
 	size_t accessory_public_key_size;
 } pair_verify_context_t;
 
+// The /accessories response rendered without the "ev" and "value" members,
+// which are spliced in at each "}" closing a characteristic object.
+typedef struct {
+	size_t offset;
+	homekit_characteristic_t *characteristic;
+} accessories_cache_splice_t;
+
+typedef struct {
+	byte *data;
+	size_t size;
+	accessories_cache_splice_t *splices;
+	size_t splices_count;
+} accessories_cache_t;
+
+// The json body of an EVENT message, rendered once for all the clients with the
+// same changes and encrypted for each of them, see homekit_server_process_notifications
+typedef struct {
+	byte *data;
+	size_t size;
+	size_t capacity;
+	bool error;
+} event_message_t;
+
+// Max plaintext size of one encrypted HAP frame
+#define HOMEKIT_FRAME_SIZE 1024
+
+// Per client input buffer, at least one encrypted HAP frame
+// (<2:AAD><HOMEKIT_FRAME_SIZE:payload><16:authTag>). All the input available is read
+// and handled in one homekit_client_process, a larger buffer takes fewer reads.
+#ifndef HOMEKIT_RECEIVE_BUFFER_SIZE
+#define HOMEKIT_RECEIVE_BUFFER_SIZE (2 + HOMEKIT_FRAME_SIZE + 16)
+#endif
+#if HOMEKIT_RECEIVE_BUFFER_SIZE < 2 + HOMEKIT_FRAME_SIZE + 16
+#error "HOMEKIT_RECEIVE_BUFFER_SIZE must fit an encrypted frame"
+#endif
+
+// Per client memory for the allocations of one request (body, query params, json
+// streams of the response...), reset when the request is handled. What does not fit
+// is allocated with malloc and freed at the same time.
+#ifndef HOMEKIT_ARENA_SIZE
+#define HOMEKIT_ARENA_SIZE 1024
+#endif
+
 typedef struct {
 	WiFiServer *wifi_server;
 	char accessory_id[ACCESSORY_ID_SIZE + 1];
@@ -85,12 +147,39 @@ typedef struct {
 	int nfds;// arduino homekit uses this to record client count
 
 	client_context_t *clients;
-} homekit_server_t;
 
-typedef struct {
-	homekit_characteristic_t *characteristic;
-	homekit_value_t value;
-} characteristic_event_t;
+	accessories_cache_t *accessories_cache; // built on the first GET /accessories
+
+	// The sum of the output_size of the clients, at most HOMEKIT_OUTPUT_BUDGET
+	size_t output_total;
+
+	// Output frame, shared by the clients since only one client writes at a time.
+	// <2:AAD><HOMEKIT_FRAME_SIZE:payload><16:authTag>, see client_write
+	byte frame[2 + HOMEKIT_FRAME_SIZE + 16];
+	size_t frame_size;
+	client_context_t *frame_client;
+
+	// The characteristics by slot (homekit_characteristic_t.slot) and the last
+	// value notified for each of them, which is what the EVENT messages carry
+	homekit_characteristic_t **characteristics;
+	homekit_value_t *characteristic_values;
+	size_t characteristics_count;
+	// The clients subscribed ("ev": true) to each characteristic, by slot,
+	// a bit (1 << client_context_t.index) per client
+	uint8_t *subscribers;
+
+	// Only with config->event_min_interval: the last time each characteristic was
+	// sent in an EVENT, and the bitmaps of the characteristics which may be sent
+	// in the current notification round and of the ones actually sent.
+	uint32_t *characteristic_sent_at;
+	uint32_t *events_ready;
+	uint32_t *events_sent;
+	// Bitmap of the characteristics in the EVENT message being sent
+	uint32_t *events_message;
+	// Whether any client may have events_pending, so that the notification round
+	// is skipped while nothing changed
+	bool events_pending;
+} homekit_server_t;
 
 struct _client_context_t {
 	homekit_server_t *server;
@@ -100,7 +189,7 @@ struct _client_context_t {
 	homekit_endpoint_t endpoint;
 	query_param_t *endpoint_params;
 
-	byte data[1024 + 18];
+	byte data[HOMEKIT_RECEIVE_BUFFER_SIZE];
 	size_t data_size;
 	size_t data_available;
 
@@ -108,6 +197,9 @@ struct _client_context_t {
 	size_t body_length;
 	http_parser parser;
 
+	arena_t arena;
+	byte arena_data[HOMEKIT_ARENA_SIZE];
+
 	int pairing_id;
 	byte permissions;
 
@@ -122,13 +214,34 @@ struct _client_context_t {
 	int count_reads;
 	int count_writes;
 
-	//QueueHandle_t event_queue;
-	Queue_t *event_queue;
+	// Bit (1 << index) of this client in server->subscribers
+	uint8_t index;
+	uint16_t subscriptions_count;
+
+	// Bitmap by characteristic slot, of server->characteristics_count bits:
+	// the characteristics changed since the last EVENT sent to this client
+	uint32_t *events;
+	bool events_pending;
+	uint32_t events_time; // millis() of the first change not sent yet
 	pair_verify_context_t *verify_context;
 
 	homekit_client_step_t step; // WangBin added
 	bool error_write; // WangBin added
 
+	// Output the socket did not take yet, a ring of output_size bytes (from
+	// HOMEKIT_OUTPUT_BUFFER_SIZE up to HOMEKIT_OUTPUT_BUFFER_MAX_SIZE) allocated
+	// while there is any, see client_output_drain
+	byte *output;
+	size_t output_size;
+	size_t output_head;
+	size_t output_length;
+
+	// GET /accessories response being written, resumed by homekit_client_process
+	// once the output queue has room again, see client_send_accessories
+	json_stream *accessories_json; // in the arena, NULL if none
+	accessories_cache_t *accessories_cache; // the cache it is written from, or NULL
+	size_t accessories_next; // the next splice of the cache, or the next accessory
+
 	struct _client_context_t *next;
 };
 
@@ -214,13 +327,6 @@ typedef enum {
 	characteristic_format_events = (1 << 4),
 } characteristic_format_t;
 
-typedef struct _client_event {
-	const homekit_characteristic_t *characteristic;
-	homekit_value_t value;
-
-	struct _client_event *next;
-} client_event_t;
-
 #define ISDIGIT(x) isdigit((unsigned char)(x))
 #define ISBASE36(x) (isdigit((unsigned char)(x)) || (x >= 'A' && x <= 'Z'))
 
@@ -228,6 +334,18 @@ typedef struct _client_event {
 void arduino_homekit_setup(homekit_server_config_t *config);
 void arduino_homekit_loop();
 
+// No work is scheduled, see arduino_homekit_next_deadline
+#define HOMEKIT_NO_DEADLINE UINT32_MAX
+
+// The milliseconds until arduino_homekit_loop has scheduled work to do: 0 if it
+// should be called again at once (queued output, events due, an SRP computation in
+// progress), the time until the next event_batch_window or event_min_interval
+// expires, or HOMEKIT_NO_DEADLINE.
+// Incoming connections and data are not scheduled: they wait in the lwIP buffers
+// until the next arduino_homekit_loop, so a sketch that sleeps on this value should
+// still cap the sleep at the latency it accepts for requests.
+uint32_t arduino_homekit_next_deadline();
+
 homekit_server_t * arduino_homekit_get_running_server();
 int arduino_homekit_connected_clients_count();
 void homekit_update_config_number();
@@ -0,0 +1,94 @@
+#include <stdlib.h>
+#include <string.h>
+#include "arena.h"
+
+#define ARENA_ALIGN sizeof(void *)
+#define ARENA_ALIGNED(size) (((size) + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1))
+#define ARENA_OVERFLOW_HEADER ARENA_ALIGNED(sizeof(arena_overflow_t))
+
+
+void arena_init(arena_t *arena, void *data, size_t size) {
+    arena->data = data;
+    arena->size = size;
+    arena->used = 0;
+    arena->last = 0;
+    arena->overflow = NULL;
+}
+
+
+static void *arena_overflow_alloc(arena_t *arena, size_t size) {
+    arena_overflow_t *overflow = malloc(ARENA_OVERFLOW_HEADER + size);
+    if (!overflow)
+        return NULL;
+
+    overflow->next = arena->overflow;
+    arena->overflow = overflow;
+
+    return (uint8_t *)overflow + ARENA_OVERFLOW_HEADER;
+}
+
+
+void *arena_alloc(arena_t *arena, size_t size) {
+    size_t offset = ARENA_ALIGNED(arena->used);
+    if (offset > arena->size || size > arena->size - offset)
+        return arena_overflow_alloc(arena, size);
+
+    arena->last = offset;
+    arena->used = offset + size;
+
+    return arena->data + offset;
+}
+
+
+void *arena_realloc(arena_t *arena, void *ptr, size_t old_size, size_t size) {
+    if (!ptr)
+        return arena_alloc(arena, size);
+
+    uint8_t *p = ptr;
+    if (p == arena->data + arena->last && arena->last + old_size == arena->used) {
+        if (size <= arena->size - arena->last) {
+            arena->used = arena->last + size;
+            return ptr;
+        }
+    } else if (arena->overflow
+               && p == (uint8_t *)arena->overflow + ARENA_OVERFLOW_HEADER) {
+        arena_overflow_t *overflow = realloc(arena->overflow, ARENA_OVERFLOW_HEADER + size);
+        if (!overflow)
+            return NULL;
+
+        arena->overflow = overflow;
+        return (uint8_t *)overflow + ARENA_OVERFLOW_HEADER;
+    } else if (size <= old_size) {
+        return ptr;
+    }
+
+    void *data = arena_alloc(arena, size);
+    if (!data)
+        return NULL;
+
+    memcpy(data, ptr, old_size < size ? old_size : size);
+    return data;
+}
+
+
+char *arena_strndup(arena_t *arena, const char *s, size_t length) {
+    char *copy = arena_alloc(arena, length + 1);
+    if (!copy)
+        return NULL;
+
+    memcpy(copy, s, length);
+    copy[length] = 0;
+    return copy;
+}
+
+
+void arena_reset(arena_t *arena) {
+    while (arena->overflow) {
+        arena_overflow_t *next = arena->overflow->next;
+        free(arena->overflow);
+        arena->overflow = next;
+    }
+
+    arena->used = 0;
+    arena->last = 0;
+}
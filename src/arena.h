@@ -0,0 +1,36 @@
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Allocations which are released all at once by arena_reset instead of one by one.
+// They are taken from a fixed block of memory, and from malloc once it is full.
+
+typedef struct _arena_overflow {
+    struct _arena_overflow *next;
+} arena_overflow_t;
+
+typedef struct {
+    uint8_t *data;
+    size_t size;
+    size_t used;
+    size_t last;  // offset of the last allocation in data, which arena_realloc grows in place
+
+    arena_overflow_t *overflow;  // the allocations from malloc, the last one first
+} arena_t;
+
+void arena_init(arena_t *arena, void *data, size_t size);
+void *arena_alloc(arena_t *arena, size_t size);
+// Grows (or shrinks) an allocation of old_size bytes, in place if it is the last one.
+// NULL ptr allocates. The data is kept on failure, like realloc.
+void *arena_realloc(arena_t *arena, void *ptr, size_t old_size, size_t size);
+char *arena_strndup(arena_t *arena, const char *s, size_t length);
+void arena_reset(arena_t *arena);
+
+#ifdef __cplusplus
+}
+#endif
@@ -1,4 +1,5 @@
 #include <string.h>
+#include <limits.h>
 
 #include "user_settings.h"
 #include <wolfssl/wolfcrypt/hmac.h>
@@ -11,7 +12,9 @@
 
 #include "homekit_debug.h"
 #include "port.h"
-#include <pgmspace.h>
+#include "arena.h"
+#include <esp_xpgm.h>
+#include "srp_comb.h"
 
 // 3072-bit group N (per RFC5054, Appendix A)
 // ~384-byte
@@ -98,11 +101,8 @@ void crypto_srp_free(Srp *srp) {
 }
 
 
-int crypto_srp_init(Srp *srp, const char *username, const char *password) {
-    DEBUG("Generating salt");
-    byte salt[16];
-    homekit_random_fill(salt, sizeof(salt));
-
+static int crypto_srp_set_params(Srp *srp, const char *username,
+                                 const byte *salt, size_t salt_size) {
     int r;
     DEBUG("Setting SRP username");
     r = wc_SrpSetUsername(srp, (byte*)username, strlen(username));
@@ -115,12 +115,659 @@ int crypto_srp_init(Srp *srp, const char *username, const char *password) {
     // Ref: https://arduino-esp8266.readthedocs.io/en/2.6.3/PROGMEM.html
 	byte N_ram[N_SIZE];
 	memcpy_P(N_ram, N, N_SIZE);
-    r = wc_SrpSetParams(srp, N_ram, N_SIZE, g, sizeof(g), salt, sizeof(salt));
+    r = wc_SrpSetParams(srp, N_ram, N_SIZE, g, sizeof(g), salt, salt_size);
     if (r) {
         DEBUG("Failed to set SRP params (code %d)", r);
         return r;
     }
 
+    return 0;
+}
+
+
+int crypto_srp_init_verifier(Srp *srp, const char *username,
+                             const byte *salt, size_t salt_size,
+                             const byte *verifier, size_t verifier_size) {
+    int r = crypto_srp_set_params(srp, username, salt, salt_size);
+    if (r)
+        return r;
+
+    srp->side = SRP_SERVER_SIDE;
+    DEBUG("Setting SRP verifier");
+    r = wc_SrpSetVerifier(srp, verifier, verifier_size);
+    if (r) {
+        DEBUG("Failed to set SRP verifier (code %d)", r);
+        return r;
+    }
+
+    return 0;
+}
+
+
+// Writes a big number left-padded with zeros to size bytes
+static int crypto_srp_export(mp_int *x, byte *buffer, size_t size) {
+    size_t x_size = mp_unsigned_bin_size(x);
+    if (x_size > size)
+        return -2;
+
+    memset(buffer, 0, size - x_size);
+    return mp_to_unsigned_bin(x, buffer + size - x_size);
+}
+
+
+// Modular exponentiation in the group N for the SRP exponentiations, called by
+// mp_exptmod (see ESP_SRP_EXPTMOD in user_settings.h). Montgomery multiplication
+// on 16-bit limbs: the ESP8266 multiplies them in one instruction, the 64-bit products
+// of 32-bit limbs are library calls. The exponent is taken CRYPTO_SRP_EXPTMOD_WINSIZE
+// bits at a time, from a table of 2^winsize - 1 powers of the base (384 bytes each).
+#ifndef CRYPTO_SRP_EXPTMOD_WINSIZE
+#define CRYPTO_SRP_EXPTMOD_WINSIZE 4
+#endif
+
+typedef uint16_t srp_limb_t;
+typedef uint32_t srp_dlimb_t;
+
+#define SRP_LIMB_SIZE 2
+#define SRP_LIMB_BITS 16
+#define SRP_LIMBS (N_SIZE / SRP_LIMB_SIZE)
+
+// -N^-1 mod 2^16 (N = -1 mod 2^64)
+#define SRP_N0 0x0001
+
+// R^2 mod N, R = 2^3072, computed offline: pow(2, 2 * 3072, N).
+// The Montgomery form of x is x * R mod N = x * R^2 / R mod N.
+const byte PROGMEM R2[] = {
+  0x5a, 0xc8, 0xb4, 0xfb, 0x51, 0xdf, 0x35, 0xda, 0x44, 0xc4, 0xe4, 0xe4,
+  0x31, 0xad, 0x02, 0x95, 0xa3, 0x32, 0xe8, 0xe3, 0xe0, 0x66, 0x9e, 0x0f,
+  0x84, 0x89, 0x5a, 0x7c, 0x55, 0x42, 0xf9, 0x6c, 0x2a, 0xd4, 0x79, 0xfe,
+  0x69, 0x69, 0x5c, 0x75, 0xfa, 0xe1, 0xcd, 0x10, 0x64, 0x8b, 0xee, 0x54,
+  0xfa, 0x02, 0x23, 0x36, 0xf2, 0x8d, 0xe7, 0x72, 0x5c, 0xaa, 0x69, 0x00,
+  0x9f, 0xbf, 0x54, 0x3f, 0x98, 0x75, 0xd4, 0xc1, 0x67, 0xdb, 0x7e, 0xdc,
+  0xaa, 0x05, 0xda, 0x05, 0xc2, 0x7f, 0xdd, 0x33, 0xaf, 0x0e, 0xc4, 0x5c,
+  0xdc, 0x39, 0x60, 0x86, 0x22, 0x76, 0xcb, 0x40, 0x57, 0x1f, 0x2c, 0x1c,
+  0x49, 0xcd, 0x9d, 0x70, 0x5d, 0xa1, 0x84, 0xd5, 0x71, 0x39, 0xd0, 0xab,
+  0x24, 0xb7, 0xe4, 0x95, 0xa5, 0xda, 0xf7, 0x36, 0xbc, 0x8d, 0x5e, 0x9e,
+  0x10, 0x9d, 0x09, 0x9e, 0x16, 0xfd, 0x75, 0x68, 0x77, 0xa5, 0xc7, 0x47,
+  0xd8, 0x5b, 0x0a, 0x83, 0x8c, 0x6c, 0xbd, 0x34, 0xd5, 0x96, 0x51, 0x34,
+  0xa7, 0x3d, 0x01, 0x03, 0x2c, 0x4b, 0x8e, 0x90, 0x7d, 0xed, 0x48, 0x9e,
+  0x67, 0x0d, 0x9c, 0x6f, 0x19, 0xc2, 0x88, 0x3e, 0xef, 0xc8, 0x02, 0xaf,
+  0x06, 0x72, 0xa3, 0x3d, 0x61, 0xe3, 0x7f, 0x74, 0x7c, 0xda, 0x50, 0x2e,
+  0xc0, 0x43, 0xf9, 0x9c, 0x9a, 0x67, 0x8b, 0xf4, 0x43, 0x9f, 0x12, 0xeb,
+  0x5a, 0x77, 0x95, 0xd8, 0x6e, 0xcc, 0x49, 0x87, 0x19, 0xcc, 0x8d, 0x59,
+  0x56, 0x37, 0x06, 0xfb, 0xb4, 0x1a, 0x05, 0xf0, 0x78, 0x02, 0x42, 0x08,
+  0xbf, 0xd9, 0x61, 0xd5, 0x38, 0xd6, 0xfc, 0xdd, 0x4f, 0x12, 0x76, 0x82,
+  0x56, 0xe8, 0x8b, 0x53, 0x78, 0x54, 0x83, 0xc6, 0x08, 0x10, 0x8c, 0x0c,
+  0x3e, 0xfe, 0xf2, 0x9d, 0xc3, 0xc0, 0xb3, 0xf4, 0x1b, 0x9d, 0x01, 0x27,
+  0x1d, 0x18, 0xf0, 0xc8, 0x1c, 0xae, 0xfc, 0x18, 0x8a, 0x59, 0xbc, 0x7f,
+  0xb1, 0x86, 0x42, 0x4b, 0x83, 0xdf, 0x28, 0x59, 0xaf, 0x80, 0xd4, 0xb5,
+  0x44, 0x35, 0x61, 0xc6, 0xfe, 0xa5, 0x18, 0x7f, 0xa7, 0x7d, 0xed, 0xda,
+  0x1d, 0x93, 0x07, 0x5a, 0xa9, 0x93, 0xd1, 0x47, 0x1e, 0xf2, 0x25, 0x71,
+  0xe4, 0x1a, 0x52, 0xb2, 0x8a, 0xa6, 0x13, 0x91, 0xab, 0xb0, 0xb7, 0x6a,
+  0xbc, 0x2b, 0x64, 0xcf, 0x26, 0xe3, 0x35, 0xd7, 0x68, 0x2a, 0xab, 0x9a,
+  0x15, 0xb1, 0x7f, 0xfa, 0xfc, 0x11, 0x87, 0xa5, 0xfa, 0x84, 0x06, 0xab,
+  0xae, 0x12, 0x84, 0x02, 0x3c, 0x6e, 0xd6, 0xa3, 0x43, 0x35, 0xaa, 0xcb,
+  0x64, 0x89, 0x4d, 0x96, 0x95, 0x82, 0x32, 0x15, 0xb1, 0x5b, 0xa5, 0x77,
+  0x4f, 0x30, 0xb9, 0x20, 0xe5, 0xc1, 0xdb, 0x66, 0x35, 0x87, 0xf0, 0x69,
+  0x60, 0xe7, 0xf1, 0x38, 0x26, 0x97, 0xca, 0x91, 0x38, 0xd2, 0x41, 0xcd
+};
+
+// The memory of one exponentiation, allocated at once: N, the accumulator,
+// the table and a double size product (+1 limb of carry)
+#define SRP_EXPTMOD_TABLE_SIZE ((1 << CRYPTO_SRP_EXPTMOD_WINSIZE) - 1)
+#define SRP_EXPTMOD_SCRATCH_SIZE \
+    ((2 + SRP_EXPTMOD_TABLE_SIZE) * N_SIZE + (2 * SRP_LIMBS + 1) * SRP_LIMB_SIZE)
+
+#if CRYPTO_SRP_EXPTMOD_WINSIZE < 1 || SRP_EXPTMOD_SCRATCH_SIZE > 40 * 1024
+#error "CRYPTO_SRP_EXPTMOD_WINSIZE must be 1 to 6, the table of 7 does not fit the heap"
+#endif
+
+
+// From big-endian N_SIZE bytes
+static void srp_limbs_read(srp_limb_t *r, const byte *data) {
+    for (int i = 0; i < SRP_LIMBS; i++) {
+        r[i] = data[N_SIZE - 1 - 2 * i] | (data[N_SIZE - 2 - 2 * i] << 8);
+    }
+}
+
+
+static void srp_limbs_write(byte *data, const srp_limb_t *a) {
+    for (int i = 0; i < SRP_LIMBS; i++) {
+        data[N_SIZE - 1 - 2 * i] = a[i];
+        data[N_SIZE - 2 - 2 * i] = a[i] >> 8;
+    }
+}
+
+
+static int srp_limbs_cmp(const srp_limb_t *a, const srp_limb_t *b) {
+    for (int i = SRP_LIMBS - 1; i >= 0; i--) {
+        if (a[i] != b[i])
+            return a[i] > b[i] ? 1 : -1;
+    }
+    return 0;
+}
+
+
+static void srp_limbs_sub(srp_limb_t *r, const srp_limb_t *a, const srp_limb_t *b) {
+    srp_dlimb_t borrow = 0;
+    for (int i = 0; i < SRP_LIMBS; i++) {
+        srp_dlimb_t d = (srp_dlimb_t) a[i] - b[i] - borrow;
+        r[i] = d;
+        borrow = (d >> SRP_LIMB_BITS) & 1;
+    }
+}
+
+
+// t = a * b, 2 * SRP_LIMBS limbs
+static void srp_limbs_mul(srp_limb_t *t, const srp_limb_t *a, const srp_limb_t *b) {
+    memset(t, 0, 2 * SRP_LIMBS * SRP_LIMB_SIZE);
+    for (int i = 0; i < SRP_LIMBS; i++) {
+        srp_dlimb_t ai = a[i];
+        srp_dlimb_t carry = 0;
+        for (int j = 0; j < SRP_LIMBS; j++) {
+            carry += t[i + j] + ai * b[j];
+            t[i + j] = carry;
+            carry >>= SRP_LIMB_BITS;
+        }
+        t[i + SRP_LIMBS] = carry;
+    }
+}
+
+
+// t = a * a, with the products a[i] * a[j] (i != j) computed once and doubled
+static void srp_limbs_sqr(srp_limb_t *t, const srp_limb_t *a) {
+    memset(t, 0, 2 * SRP_LIMBS * SRP_LIMB_SIZE);
+    for (int i = 0; i < SRP_LIMBS - 1; i++) {
+        srp_dlimb_t ai = a[i];
+        srp_dlimb_t carry = 0;
+        for (int j = i + 1; j < SRP_LIMBS; j++) {
+            carry += t[i + j] + ai * a[j];
+            t[i + j] = carry;
+            carry >>= SRP_LIMB_BITS;
+        }
+        t[i + SRP_LIMBS] = carry;
+    }
+
+    srp_dlimb_t carry = 0;
+    for (int i = 0; i < SRP_LIMBS; i++) {
+        srp_dlimb_t square = (srp_dlimb_t) a[i] * a[i];
+        carry += ((srp_dlimb_t) t[2 * i] << 1) + (square & 0xffff);
+        t[2 * i] = carry;
+        carry >>= SRP_LIMB_BITS;
+        carry += ((srp_dlimb_t) t[2 * i + 1] << 1) + (square >> SRP_LIMB_BITS);
+        t[2 * i + 1] = carry;
+        carry >>= SRP_LIMB_BITS;
+    }
+}
+
+
+// r = t / R mod N, for t < N * R of 2 * SRP_LIMBS limbs (t is overwritten and
+// needs one more limb for the carry)
+static void srp_limbs_reduce(srp_limb_t *r, srp_limb_t *t, const srp_limb_t *n) {
+    t[2 * SRP_LIMBS] = 0;
+    for (int i = 0; i < SRP_LIMBS; i++) {
+        srp_dlimb_t m = (srp_limb_t) ((srp_dlimb_t) t[i] * SRP_N0);
+        srp_dlimb_t carry = 0;
+        for (int j = 0; j < SRP_LIMBS; j++) {
+            carry += t[i + j] + m * n[j];
+            t[i + j] = carry;
+            carry >>= SRP_LIMB_BITS;
+        }
+        for (int k = i + SRP_LIMBS; carry; k++) {
+            carry += t[k];
+            t[k] = carry;
+            carry >>= SRP_LIMB_BITS;
+        }
+    }
+
+    // t / R < 2 * N
+    srp_limb_t *u = t + SRP_LIMBS;
+    if (u[SRP_LIMBS] || srp_limbs_cmp(u, n) >= 0) {
+        srp_limbs_sub(r, u, n);
+    } else {
+        memcpy(r, u, N_SIZE);
+    }
+}
+
+
+// Bit i of the magnitude of a
+static int srp_mp_bit(mp_int *a, int i) {
+    int digit = i / DIGIT_BIT;
+    if (digit >= a->used)
+        return 0;
+
+    return (a->dp[digit] >> (i % DIGIT_BIT)) & 1;
+}
+
+
+int crypto_srp_is_modulus(mp_int *p) {
+    if (p->sign == MP_NEG || mp_count_bits(p) != N_SIZE * 8)
+        return 0;
+
+    // Compare a byte at a time from the digits, without a N_SIZE buffer on the stack
+    int bit = 0;
+    for (int i = N_SIZE - 1; i >= 0; i--, bit += 8) {
+        int digit = bit / DIGIT_BIT;
+        int shift = bit % DIGIT_BIT;
+        mp_word b = p->dp[digit] >> shift;
+        if (shift + 8 > DIGIT_BIT && digit + 1 < p->used)
+            b |= (mp_word) p->dp[digit + 1] << (DIGIT_BIT - shift);
+
+        if ((byte) b != pgm_read_byte(N + i))
+            return 0;
+    }
+
+    return 1;
+}
+
+
+#define SRP_MULMOD_SCRATCH_SIZE (3 * N_SIZE + (2 * SRP_LIMBS + 1) * SRP_LIMB_SIZE)
+
+
+// Y = a / R mod N, out of the Montgomery form (a and t are overwritten)
+static int srp_limbs_export(mp_int *Y, srp_limb_t *a, srp_limb_t *t, const srp_limb_t *n) {
+    memcpy(t, a, N_SIZE);
+    memset(t + SRP_LIMBS, 0, N_SIZE);
+    srp_limbs_reduce(a, t, n);
+
+    srp_limbs_write((byte *) t, a);
+    return mp_read_unsigned_bin(Y, (byte *) t, N_SIZE);
+}
+
+
+// Y = A * B mod N for A, B < N, by two Montgomery multiplications (A * B / R, then
+// by R^2) instead of the long division of mp_mulmod
+static int srp_mulmod(mp_int *A, mp_int *B, mp_int *Y) {
+    byte *scratch = malloc(SRP_MULMOD_SCRATCH_SIZE);
+    if (!scratch)
+        return MP_MEM;
+
+    arena_t arena;
+    arena_init(&arena, scratch, SRP_MULMOD_SCRATCH_SIZE);
+    srp_limb_t *n = arena_alloc(&arena, N_SIZE);
+    srp_limb_t *a = arena_alloc(&arena, N_SIZE);
+    srp_limb_t *b = arena_alloc(&arena, N_SIZE);
+    srp_limb_t *t = arena_alloc(&arena, (2 * SRP_LIMBS + 1) * SRP_LIMB_SIZE);
+    byte *data = (byte *) t;
+
+    memcpy_P(data, N, N_SIZE);
+    srp_limbs_read(n, data);
+    int r = crypto_srp_export(A, data, N_SIZE);
+    srp_limbs_read(a, data);
+    if (!r)
+        r = crypto_srp_export(B, data, N_SIZE);
+    if (!r) {
+        srp_limbs_read(b, data);
+        srp_limbs_mul(t, a, b);
+        srp_limbs_reduce(a, t, n);
+        memcpy_P(data, R2, N_SIZE);
+        srp_limbs_read(b, data);
+        srp_limbs_mul(t, a, b);
+        srp_limbs_reduce(a, t, n);
+
+        srp_limbs_write(data, a);
+        r = mp_read_unsigned_bin(Y, data, N_SIZE);
+    }
+
+    free(scratch);
+    return r;
+}
+
+
+// An exponentiation G^X mod N in progress, advanced a bounded number of Montgomery
+// multiplications (or squarings) at a time by srp_exptmod_step.
+// g^X for X of up to SRP_COMB_BITS bits (the private key b of B = k*v + g^b) uses
+// the comb in flash: SRP_COMB_SPACING - 1 squarings and as many multiplications at
+// most, instead of one squaring per bit of X. Other bases use the window table.
+typedef struct {
+    mp_int *X;     // kept by the caller until srp_exptmod_finish
+    int bits;
+    int comb;
+    int k;         // window: the table entries computed
+    int i;         // the exponent bit of the current window or comb column
+    int squarings; // the squarings done for the current window or column
+    int started;   // acc is set
+
+    byte *scratch;
+    arena_t arena;
+    srp_limb_t *n;
+    srp_limb_t *acc;
+    srp_limb_t *table;  // comb: the column entry
+    srp_limb_t *t;
+} srp_exptmod_t;
+
+#define SRP_COMB_SCRATCH_SIZE (3 * N_SIZE + (2 * SRP_LIMBS + 1) * SRP_LIMB_SIZE)
+
+
+static void srp_exptmod_free(srp_exptmod_t *e) {
+    if (e->scratch) {
+        arena_reset(&e->arena);
+        free(e->scratch);
+        e->scratch = NULL;
+    }
+}
+
+
+static int srp_exptmod_init(srp_exptmod_t *e, mp_int *G, mp_int *X, mp_int *P) {
+    memset(e, 0, sizeof(*e));
+    if (X->sign == MP_NEG)
+        return MP_VAL;
+
+    e->X = X;
+    e->bits = mp_count_bits(X);
+    e->i = -1;
+    if (!e->bits)
+        return 0;
+
+    e->comb = e->bits <= SRP_COMB_BITS && mp_cmp_d(G, g[0]) == MP_EQ;
+
+    mp_int base;
+    int r = mp_init(&base);
+    if (r)
+        return r;
+
+    if (!e->comb) {
+        if (G->sign == MP_NEG || mp_cmp_mag(G, P) != MP_LT) {
+            r = mp_mod(G, P, &base);
+        } else {
+            r = mp_copy(G, &base);
+        }
+    }
+
+    size_t scratch_size = e->comb ? SRP_COMB_SCRATCH_SIZE : SRP_EXPTMOD_SCRATCH_SIZE;
+    if (!r) {
+        e->scratch = malloc(scratch_size);
+        if (!e->scratch)
+            r = MP_MEM;
+    }
+    if (r) {
+        mp_clear(&base);
+        return r;
+    }
+
+    arena_init(&e->arena, e->scratch, scratch_size);
+    e->n = arena_alloc(&e->arena, N_SIZE);
+    e->acc = arena_alloc(&e->arena, N_SIZE);
+    e->table = arena_alloc(&e->arena,
+                           e->comb ? N_SIZE : SRP_EXPTMOD_TABLE_SIZE * N_SIZE);
+    e->t = arena_alloc(&e->arena, (2 * SRP_LIMBS + 1) * SRP_LIMB_SIZE);
+    byte *data = (byte *) e->t;
+
+    memcpy_P(data, N, N_SIZE);
+    srp_limbs_read(e->n, data);
+
+    if (e->comb) {
+        e->i = SRP_COMB_SPACING - 1;
+    } else {
+        // The base and R^2 (in acc until it is started) to compute table[0]
+        r = crypto_srp_export(&base, data, N_SIZE);
+        srp_limbs_read(e->table, data);
+        memcpy_P(data, R2, N_SIZE);
+        srp_limbs_read(e->acc, data);
+        // Left to right, from the top window
+        e->i = (e->bits - 1) / CRYPTO_SRP_EXPTMOD_WINSIZE * CRYPTO_SRP_EXPTMOD_WINSIZE;
+    }
+    mp_clear(&base);
+    if (r)
+        srp_exptmod_free(e);
+
+    return r;
+}
+
+
+// Does up to *operations Montgomery multiplications, less the ones done.
+// Returns 1 while there is more to do.
+static int srp_exptmod_step(srp_exptmod_t *e, int *operations) {
+    srp_limb_t *acc = e->acc;
+    srp_limb_t *t = e->t;
+
+    while (e->i >= 0 && *operations > 0) {
+        if (!e->comb && e->k < SRP_EXPTMOD_TABLE_SIZE) {
+            // table[k] = G^(k + 1) * R mod N
+            if (e->k) {
+                srp_limbs_mul(t, e->table + (e->k - 1) * SRP_LIMBS, e->table);
+            } else {
+                srp_limbs_mul(t, e->table, acc);
+            }
+            srp_limbs_reduce(e->table + e->k * SRP_LIMBS, t, e->n);
+            e->k++;
+            (*operations)--;
+            continue;
+        }
+
+        int steps = e->comb ? 1 : CRYPTO_SRP_EXPTMOD_WINSIZE;
+        if (e->started && e->squarings < steps) {
+            srp_limbs_sqr(t, acc);
+            srp_limbs_reduce(acc, t, e->n);
+            e->squarings++;
+            (*operations)--;
+            continue;
+        }
+
+        int column = 0;
+        srp_limb_t *entry = NULL;
+        if (e->comb) {
+            for (int j = SRP_COMB_TEETH - 1; j >= 0; j--)
+                column = (column << 1) | srp_mp_bit(e->X, j * SRP_COMB_SPACING + e->i);
+            if (column) {
+                memcpy_P(t, srp_comb + (column - 1) * N_SIZE, N_SIZE);
+                srp_limbs_read(e->table, (byte *) t);
+                entry = e->table;
+            }
+            e->i--;
+        } else {
+            // The top window is not 0
+            for (int b = CRYPTO_SRP_EXPTMOD_WINSIZE - 1; b >= 0; b--)
+                column = (column << 1) | srp_mp_bit(e->X, e->i + b);
+            if (column)
+                entry = e->table + (column - 1) * SRP_LIMBS;
+            e->i -= CRYPTO_SRP_EXPTMOD_WINSIZE;
+        }
+        e->squarings = 0;
+
+        if (!entry)
+            continue;
+        if (e->started) {
+            srp_limbs_mul(t, acc, entry);
+            srp_limbs_reduce(acc, t, e->n);
+            (*operations)--;
+        } else {
+            memcpy(acc, entry, N_SIZE);
+            e->started = 1;
+        }
+    }
+
+    return e->i >= 0;
+}
+
+
+static int srp_exptmod_finish(srp_exptmod_t *e, mp_int *Y) {
+    int r = e->bits ? srp_limbs_export(Y, e->acc, e->t, e->n) : mp_set(Y, 1);
+    srp_exptmod_free(e);
+    return r;
+}
+
+
+// An SRP computation spread over calls of crypto_srp_job_step, see crypto.h. Its
+// operations (a^b or a*b mod N) are done in order, then the crypto_srp_*_finish
+// function calls wolfcrypt, whose mp_exptmod and mp_mulmod calls in the group take
+// the results (see crypto_srp_exptmod and crypto_srp_mulmod).
+#define SRP_JOB_OPERATIONS 3
+
+typedef struct _crypto_srp_job {
+    Srp *srp;
+    mp_int a[SRP_JOB_OPERATIONS];
+    mp_int b[SRP_JOB_OPERATIONS];
+    mp_int result[SRP_JOB_OPERATIONS];
+    int mulmod[SRP_JOB_OPERATIONS];
+    int chained[SRP_JOB_OPERATIONS];  // a is the result of the previous operation
+    int count;
+    int current;
+    int started;  // exptmod is set up for the current one
+    int error;
+    srp_exptmod_t exptmod;
+} crypto_srp_job_t;
+
+// The job of the crypto_srp_*_finish in progress
+static crypto_srp_job_t *srp_job_finishing = NULL;
+
+
+int crypto_srp_exptmod(mp_int *G, mp_int *X, mp_int *P, mp_int *Y) {
+    crypto_srp_job_t *job = srp_job_finishing;
+    if (job) {
+        for (int i = 0; i < job->current; i++) {
+            if (!job->mulmod[i] && mp_cmp(G, &job->a[i]) == MP_EQ
+                    && mp_cmp(X, &job->b[i]) == MP_EQ)
+                return mp_copy(&job->result[i], Y);
+        }
+    }
+
+    srp_exptmod_t e;
+    int r = srp_exptmod_init(&e, G, X, P);
+    if (r)
+        return r;
+
+    int operations = INT_MAX;
+    while (srp_exptmod_step(&e, &operations))
+        operations = INT_MAX;
+
+    return srp_exptmod_finish(&e, Y);
+}
+
+
+// Modular multiplication in the group N, called by mp_mulmod for A, B < N (see
+// ESP_SRP_EXPTMOD in user_settings.h): two Montgomery multiplications instead of
+// the product and its long division.
+int crypto_srp_mulmod(mp_int *A, mp_int *B, mp_int *P, mp_int *Y) {
+    (void) P;
+    crypto_srp_job_t *job = srp_job_finishing;
+    if (job) {
+        for (int i = 0; i < job->current; i++) {
+            if (!job->mulmod[i])
+                continue;
+            if ((mp_cmp(A, &job->a[i]) == MP_EQ && mp_cmp(B, &job->b[i]) == MP_EQ)
+                    || (mp_cmp(A, &job->b[i]) == MP_EQ && mp_cmp(B, &job->a[i]) == MP_EQ))
+                return mp_copy(&job->result[i], Y);
+        }
+    }
+
+    return srp_mulmod(A, B, Y);
+}
+
+
+static crypto_srp_job_t *srp_job_new(Srp *srp) {
+    crypto_srp_job_t *job = calloc(1, sizeof(crypto_srp_job_t));
+    if (!job)
+        return NULL;
+
+    job->srp = srp;
+    for (int i = 0; i < SRP_JOB_OPERATIONS; i++) {
+        mp_init(&job->a[i]);
+        mp_init(&job->b[i]);
+        mp_init(&job->result[i]);
+    }
+
+    return job;
+}
+
+
+void crypto_srp_job_free(crypto_srp_job_t *job) {
+    if (!job)
+        return;
+
+    if (job->started)
+        srp_exptmod_free(&job->exptmod);
+    for (int i = 0; i < SRP_JOB_OPERATIONS; i++) {
+        mp_clear(&job->a[i]);
+        mp_clear(&job->b[i]);
+        mp_clear(&job->result[i]);
+    }
+    free(job);
+}
+
+
+// Adds a^b mod N, or a*b mod N with mulmod (a, b < N). A NULL a is the result of
+// the previous operation.
+static int srp_job_add(crypto_srp_job_t *job, int mulmod, mp_int *a, mp_int *b) {
+    int i = job->count++;
+    job->mulmod[i] = mulmod;
+    job->chained[i] = !a;
+    int r = a ? mp_copy(a, &job->a[i]) : 0;
+    if (!r)
+        r = mp_copy(b, &job->b[i]);
+
+    return r;
+}
+
+
+int crypto_srp_job_step(crypto_srp_job_t *job, int operations) {
+    int r;
+    if (job->error)
+        return job->error;
+
+    while (job->current < job->count) {
+        int i = job->current;
+        if (operations <= 0)
+            return 1;
+
+        if (!job->started) {
+            r = job->chained[i] ? mp_copy(&job->result[i - 1], &job->a[i]) : 0;
+            if (!r && job->mulmod[i]) {
+                // Two Montgomery multiplications
+                r = srp_mulmod(&job->a[i], &job->b[i], &job->result[i]);
+                if (r)
+                    return job->error = r;
+                operations -= 2;
+                job->current++;
+                continue;
+            }
+            if (!r)
+                r = srp_exptmod_init(&job->exptmod, &job->a[i], &job->b[i], &job->srp->N);
+            if (r)
+                return job->error = r;
+            job->started = 1;
+        }
+
+        if (srp_exptmod_step(&job->exptmod, &operations))
+            return 1;
+
+        job->started = 0;
+        r = srp_exptmod_finish(&job->exptmod, &job->result[i]);
+        if (r)
+            return job->error = r;
+        job->current++;
+    }
+
+    return 0;
+}
+
+
+// Runs a job to the end, for the blocking functions
+static int srp_job_run(crypto_srp_job_t *job) {
+    int r;
+    while ((r = crypto_srp_job_step(job, INT_MAX)) > 0)
+        ;
+    return r;
+}
+
+
+static int srp_job_done(crypto_srp_job_t *job) {
+    if (job->error)
+        return job->error;
+
+    return job->current < job->count ? SRP_CALL_ORDER_E : 0;
+}
+
+
+int crypto_srp_init_begin(Srp *srp, const char *username, const char *password,
+                          crypto_srp_job_t **job) {
+    DEBUG("Generating salt");
+    byte salt[16];
+    homekit_random_fill(salt, sizeof(salt));
+
+    int r = crypto_srp_set_params(srp, username, salt, sizeof(salt));
+    if (r)
+        return r;
+
     DEBUG("Setting SRP password");
     r = wc_SrpSetPassword(srp, (byte *)password, strlen(password));
     if (r) {
@@ -128,10 +775,32 @@ int crypto_srp_init(Srp *srp, const char *username, const char *password) {
         return r;
     }
 
+    // v = g^x, x is in srp->auth
+    *job = srp_job_new(srp);
+    if (!*job)
+        return MEMORY_E;
+
+    r = srp_job_add(*job, 0, &srp->g, &srp->auth);
+    if (r) {
+        crypto_srp_job_free(*job);
+        *job = NULL;
+    }
+
+    return r;
+}
+
+
+int crypto_srp_init_finish(Srp *srp, crypto_srp_job_t *job) {
+    int r = srp_job_done(job);
+    if (r)
+        return r;
+
     DEBUG("Getting SRP verifier");
     word32 verifierLen = 1024;
     byte *verifier = malloc(verifierLen);
+    srp_job_finishing = job;
     r = wc_SrpGetVerifier(srp, verifier, &verifierLen);
+    srp_job_finishing = NULL;
     if (r) {
         DEBUG("Failed to get SRP verifier (code %d)", r);
         free(verifier);
@@ -153,6 +822,39 @@ int crypto_srp_init(Srp *srp, const char *username, const char *password) {
 }
 
 
+int crypto_srp_init(Srp *srp, const char *username, const char *password) {
+    crypto_srp_job_t *job;
+    int r = crypto_srp_init_begin(srp, username, password, &job);
+    if (r)
+        return r;
+
+    r = srp_job_run(job);
+    if (!r)
+        r = crypto_srp_init_finish(srp, job);
+
+    crypto_srp_job_free(job);
+    return r;
+}
+
+
+int crypto_srp_get_verifier(Srp *srp, byte *buffer, size_t buffer_size) {
+    if (srp->side != SRP_SERVER_SIDE)
+        return -1;
+
+    return crypto_srp_export(&srp->auth, buffer, buffer_size);
+}
+
+
+int crypto_srp_get_private_key(Srp *srp, byte *buffer, size_t buffer_size) {
+    return crypto_srp_export(&srp->priv, buffer, buffer_size);
+}
+
+
+int crypto_srp_set_private_key(Srp *srp, const byte *key, size_t key_size) {
+    return wc_SrpSetPrivate(srp, key, key_size);
+}
+
+
 int crypto_srp_get_salt(Srp *srp, byte *buffer, size_t *buffer_size) {
     if (buffer_size == NULL)
         return -1;
@@ -168,7 +870,46 @@ int crypto_srp_get_salt(Srp *srp, byte *buffer, size_t *buffer_size) {
 }
 
 
-int crypto_srp_get_public_key(Srp *srp, byte *buffer, size_t *buffer_size) {
+int crypto_srp_get_public_key_begin(Srp *srp, crypto_srp_job_t **job) {
+    int r = 0;
+    // b = random(), as wc_SrpGetPublic would
+    if (mp_iszero(&srp->priv) == MP_YES) {
+        byte private_key[SRP_PRIVATE_KEY_MIN_BITS / 8];
+        homekit_random_fill(private_key, sizeof(private_key));
+        r = wc_SrpSetPrivate(srp, private_key, sizeof(private_key));
+        if (r)
+            return r;
+    }
+
+    // g^b, and k*v (the hash of crypto_srp_new is SHA512)
+    *job = srp_job_new(srp);
+    if (!*job)
+        return MEMORY_E;
+
+    mp_int k;
+    r = mp_init(&k);
+    if (r) {
+        crypto_srp_job_free(*job);
+        *job = NULL;
+        return r;
+    }
+    r = srp_job_add(*job, 0, &srp->g, &srp->priv);
+    if (!r)
+        r = mp_read_unsigned_bin(&k, srp->k, WC_SHA512_DIGEST_SIZE);
+    if (!r)
+        r = srp_job_add(*job, 1, &k, &srp->auth);
+    mp_clear(&k);
+    if (r) {
+        crypto_srp_job_free(*job);
+        *job = NULL;
+    }
+
+    return r;
+}
+
+
+int crypto_srp_get_public_key_finish(Srp *srp, crypto_srp_job_t *job,
+                                     byte *buffer, size_t *buffer_size) {
     if (buffer_size == NULL)
         return -1;
 
@@ -178,24 +919,130 @@ int crypto_srp_get_public_key(Srp *srp, byte *buffer, size_t *buffer_size) {
         return -2;
     }
 
+    int r = srp_job_done(job);
+    if (r)
+        return r;
+
     DEBUG("Calculating public key");
     word32 len = *buffer_size;
-    int r = wc_SrpGetPublic(srp, buffer, &len);
+    srp_job_finishing = job;
+    r = wc_SrpGetPublic(srp, buffer, &len);
+    srp_job_finishing = NULL;
     *buffer_size = len;
     return r;
 }
 
 
-int crypto_srp_compute_key(
+int crypto_srp_get_public_key(Srp *srp, byte *buffer, size_t *buffer_size) {
+    if (buffer_size == NULL)
+        return -1;
+
+    // TODO: Fix hardcoded public key size
+    if (*buffer_size < 384) {
+        *buffer_size = 384;
+        return -2;
+    }
+
+    crypto_srp_job_t *job;
+    int r = crypto_srp_get_public_key_begin(srp, &job);
+    if (r)
+        return r;
+
+    r = srp_job_run(job);
+    if (!r)
+        r = crypto_srp_get_public_key_finish(srp, job, buffer, buffer_size);
+
+    crypto_srp_job_free(job);
+    return r;
+}
+
+
+int crypto_srp_compute_key_begin(
     Srp *srp,
     const byte *client_public_key, size_t client_public_key_size,
+    const byte *server_public_key, size_t server_public_key_size,
+    crypto_srp_job_t **job
+) {
+    if (client_public_key_size > N_SIZE || server_public_key_size > N_SIZE)
+        return BAD_FUNC_ARG;
+
+    // u = H(A | B), A and B left-padded to the size of N as in wc_SrpComputeKey
+    // (the hash of crypto_srp_new is SHA512)
+    byte u_digest[WC_SHA512_DIGEST_SIZE];
+    byte pad[16];
+    wc_Sha512 sha;
+    memset(pad, 0, sizeof(pad));
+
+    int r = wc_InitSha512(&sha);
+    for (size_t i = client_public_key_size; !r && i < N_SIZE; i += sizeof(pad))
+        r = wc_Sha512Update(&sha, pad, MIN(sizeof(pad), N_SIZE - i));
+    if (!r)
+        r = wc_Sha512Update(&sha, client_public_key, client_public_key_size);
+    for (size_t i = server_public_key_size; !r && i < N_SIZE; i += sizeof(pad))
+        r = wc_Sha512Update(&sha, pad, MIN(sizeof(pad), N_SIZE - i));
+    if (!r)
+        r = wc_Sha512Update(&sha, server_public_key, server_public_key_size);
+    if (!r)
+        r = wc_Sha512Final(&sha, u_digest);
+    if (r)
+        return r;
+
+    // S = (A * v^u)^b
+    *job = srp_job_new(srp);
+    if (!*job)
+        return MEMORY_E;
+
+    mp_int a, u;
+    r = mp_init(&a);
+    if (!r) {
+        r = mp_init(&u);
+        if (r)
+            mp_clear(&a);
+    }
+    if (r) {
+        crypto_srp_job_free(*job);
+        *job = NULL;
+        return r;
+    }
+    r = mp_read_unsigned_bin(&a, client_public_key, client_public_key_size);
+    // 0 < A < N, as wc_SrpComputeKey checks
+    if (!r && (mp_iszero(&a) == MP_YES || mp_cmp(&a, &srp->N) != MP_LT))
+        r = SRP_BAD_KEY_E;
+    if (!r)
+        r = mp_read_unsigned_bin(&u, u_digest, sizeof(u_digest));
+    if (!r)
+        r = srp_job_add(*job, 0, &srp->auth, &u);
+    if (!r)
+        r = srp_job_add(*job, 1, NULL, &a);
+    if (!r)
+        r = srp_job_add(*job, 0, NULL, &srp->priv);
+    mp_clear(&a);
+    mp_clear(&u);
+    if (r) {
+        crypto_srp_job_free(*job);
+        *job = NULL;
+    }
+
+    return r;
+}
+
+
+int crypto_srp_compute_key_finish(
+    Srp *srp, crypto_srp_job_t *job,
+    const byte *client_public_key, size_t client_public_key_size,
     const byte *server_public_key, size_t server_public_key_size
 ) {
-    int r = wc_SrpComputeKey(
+    int r = srp_job_done(job);
+    if (r)
+        return r;
+
+    srp_job_finishing = job;
+    r = wc_SrpComputeKey(
         srp,
         (byte *)client_public_key, client_public_key_size,
         (byte *)server_public_key, server_public_key_size
     );
+    srp_job_finishing = NULL;
     if (r) {
         DEBUG("Failed to generate SRP shared secret key (code %d)", r);
         return r;
@@ -205,6 +1052,27 @@ int crypto_srp_compute_key(
 }
 
 
+int crypto_srp_compute_key(
+    Srp *srp,
+    const byte *client_public_key, size_t client_public_key_size,
+    const byte *server_public_key, size_t server_public_key_size
+) {
+    crypto_srp_job_t *job;
+    int r = crypto_srp_compute_key_begin(srp, client_public_key, client_public_key_size,
+                                         server_public_key, server_public_key_size, &job);
+    if (r)
+        return r;
+
+    r = srp_job_run(job);
+    if (!r)
+        r = crypto_srp_compute_key_finish(srp, job, client_public_key, client_public_key_size,
+                                          server_public_key, server_public_key_size);
+
+    crypto_srp_job_free(job);
+    return r;
+}
+
+
 int crypto_srp_verify(Srp *srp, const byte *proof, size_t proof_size) {
     int r = wc_SrpVerifyPeersProof(srp, (byte *)proof, proof_size);
     if (r) {
@@ -41,6 +41,18 @@ Srp *crypto_srp_new();
 void crypto_srp_free(Srp *srp);
 
 int crypto_srp_init(Srp *srp, const char *username, const char *password);
+// Server side setup from a salt and verifier computed before (by crypto_srp_init,
+// or provisioned), instead of the password
+int crypto_srp_init_verifier(Srp *srp, const char *username,
+                             const byte *salt, size_t salt_size,
+                             const byte *verifier, size_t verifier_size);
+// The verifier and the private key (b) of the server, left-padded to buffer_size,
+// to set up a later crypto_srp_init_verifier and crypto_srp_set_private_key
+int crypto_srp_get_verifier(Srp *srp, byte *buffer, size_t buffer_size);
+int crypto_srp_get_private_key(Srp *srp, byte *buffer, size_t buffer_size);
+// Sets the private key instead of a random one, before crypto_srp_get_public_key
+// (or instead of it, with the public key of that private key kept with it)
+int crypto_srp_set_private_key(Srp *srp, const byte *key, size_t key_size);
 
 int crypto_srp_get_salt(Srp *srp, byte *buffer, size_t *buffer_length);
 int crypto_srp_get_public_key(Srp *srp, byte *buffer, size_t *buffer_length);
@@ -50,6 +62,36 @@ int crypto_srp_compute_key(
     const byte *client_public_key, size_t client_public_key_size,
     const byte *server_public_key, size_t server_public_key_size
 );
+
+// The same computations in steps, so that the caller can keep serving (and feeding
+// the watchdog) between them: *_begin starts a job, crypto_srp_job_step is called
+// until it returns 0 (<0 on error), and *_finish ends it as the blocking function
+// would. operations is the number of 3072-bit Montgomery multiplications done by
+// a step at most. The job is freed by the caller, also when it did not finish.
+struct _crypto_srp_job;
+typedef struct _crypto_srp_job crypto_srp_job_t;
+
+int crypto_srp_job_step(crypto_srp_job_t *job, int operations);
+void crypto_srp_job_free(crypto_srp_job_t *job);
+
+int crypto_srp_init_begin(Srp *srp, const char *username, const char *password,
+                          crypto_srp_job_t **job);
+int crypto_srp_init_finish(Srp *srp, crypto_srp_job_t *job);
+int crypto_srp_get_public_key_begin(Srp *srp, crypto_srp_job_t **job);
+int crypto_srp_get_public_key_finish(Srp *srp, crypto_srp_job_t *job,
+                                     byte *buffer, size_t *buffer_length);
+int crypto_srp_compute_key_begin(
+    Srp *srp,
+    const byte *client_public_key, size_t client_public_key_size,
+    const byte *server_public_key, size_t server_public_key_size,
+    crypto_srp_job_t **job
+);
+int crypto_srp_compute_key_finish(
+    Srp *srp, crypto_srp_job_t *job,
+    const byte *client_public_key, size_t client_public_key_size,
+    const byte *server_public_key, size_t server_public_key_size
+);
+
 int crypto_srp_verify(Srp *srp, const byte *proof, size_t proof_size);
 int crypto_srp_get_proof(Srp *srp, byte *proof, size_t *proof_size);
 
@@ -12,10 +12,29 @@
 extern "C" {
 #endif
 
-#include <pgmspace.h>
 #include <stdint.h>
 #include <string.h>
 
+#ifdef ARDUINO
+#include <pgmspace.h>
+#else
+// Host build: there is no separate flash address space
+#include <stdio.h>
+#define PROGMEM
+#define PGM_P const char *
+#define PSTR(s) (s)
+#define memcpy_P memcpy
+#define strlen_P strlen
+#define strcpy_P strcpy
+#define strncpy_P strncpy
+#define strcmp_P strcmp
+#define printf_P printf
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#define ICACHE_RODATA_ATTR
+#endif
+
 //see "osapi.h"
 /*
  This function works only after Serial.setDebugOutput(true); ?
@@ -54,6 +54,21 @@ typedef struct {
     void (*on_resource)(const char *body, size_t body_size);
 
     void (*on_event)(homekit_event_t event);
+
+    // Minimum time between two EVENT notifications of the same characteristic,
+    // in milliseconds. Changes within this time are merged and sent once it has
+    // elapsed, with the latest value. 0: no limit.
+    uint16_t event_min_interval;
+
+    // Time to collect changes for a controller after the first one, in milliseconds,
+    // so that a burst of changes is sent in one EVENT message. 0: send at once.
+    uint16_t event_batch_window;
+
+    // Optional SRP salt (16 bytes) and verifier (384 bytes) of the password,
+    // provisioned at the factory: pair-setup uses them instead of computing
+    // the verifier from the password (which is still needed for the QR code).
+    const unsigned char *setup_salt;
+    const unsigned char *setup_verifier;
 } homekit_server_config_t;
 
 // Get pairing URI
@@ -215,6 +215,10 @@ struct _homekit_characteristic {
     void (*setter_ex)(homekit_characteristic_t *ch, const homekit_value_t value);
 
     void *context;
+
+    // Position among all characteristics of the accessories (0, 1, 2, ...),
+    // assigned by homekit_accessories_init
+    uint16_t slot;
 };
 
 struct _homekit_service {
@@ -321,6 +325,9 @@ homekit_characteristic_t *homekit_characteristic_clone(homekit_characteristic_t
 
 // Init accessories by automatically assigning IDs to all
 // accessories/services/characteristics, normalizing internal data.
+// Also numbers the characteristics (slot) and builds the (aid, iid) index used by
+// homekit_characteristic_by_aid_and_iid, so call it again after adding or removing
+// characteristics.
 void homekit_accessories_init(homekit_accessory_t **accessories);
 
 // Find accessory by ID. Returns NULL if not found
@@ -5,7 +5,7 @@
 
 
 char *binary_to_string(const byte *data, size_t size) {
-    int i;
+    size_t i;
 
     size_t buffer_size = 1; // 1 char for eos
     for (i=0; i<size; i++)
@@ -7,7 +7,11 @@ extern "C" {
 
 #include <stdlib.h>
 #include <stdio.h>
+#ifdef ARDUINO
 #include "Arduino.h"
+#else
+#include "port.h"
+#endif
 #include <string.h>
 #include <esp_xpgm.h>
 
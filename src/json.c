@@ -1,7 +1,7 @@
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
-#include <stdarg.h>
+#include <string.h>
 #include "json.h"
 
 #include "homekit_debug.h"
@@ -10,8 +10,9 @@
 #define MAX(a, b) (((a) > (b)) ? (a) : (b))
 
 #define DEBUG_STATE(json) \
-    DEBUG("State = %d, last JSON output: %s", \
-          json->state, json->buffer + MAX(0, (long int)json->pos - 20));
+    DEBUG("State = %d, last JSON output: %.*s", \
+          json->state, (int)(json->pos - MAX(0, (long int)json->pos - 20)), \
+          json->buffer + MAX(0, (long int)json->pos - 20));
 
 typedef enum {
     JSON_STATE_START = 1,
@@ -45,16 +46,29 @@ struct json_stream {
 
 
 json_stream *json_new(size_t buffer_size, json_flush_callback on_flush, void *context) {
+    // Numbers are formatted in place, so they have to fit in the buffer
+    if (buffer_size < JSON_NUMBER_SIZE + 2)
+        buffer_size = JSON_NUMBER_SIZE + 2;
+
     json_stream *json = malloc(sizeof(json_stream));
+    json_init(json, malloc(buffer_size), buffer_size, on_flush, context);
+
+    return json;
+}
+
+void json_init(json_stream *json, uint8_t *buffer, size_t buffer_size,
+               json_flush_callback on_flush, void *context) {
     json->size = buffer_size;
     json->pos = 0;
-    json->buffer = malloc(json->size);
+    json->buffer = buffer;
     json->state = JSON_STATE_START;
     json->nesting_idx = 0;
     json->on_flush = on_flush;
     json->context = context;
+}
 
-    return json;
+size_t json_stream_size() {
+    return sizeof(json_stream);
 }
 
 void json_free(json_stream *json) {
@@ -71,29 +85,28 @@ void json_flush(json_stream *json) {
     json->pos = 0;
 }
 
-void json_write(json_stream *json, const char *format, ...) {
-    va_list arg_ptr;
+void json_raw(json_stream *json, const uint8_t *data, size_t size) {
+    while (size) {
+        size_t len = json->size - 1 - json->pos;
+        if (!len) {
+            json_flush(json);
+            continue;
+        }
+        if (len > size)
+            len = size;
 
-    va_start(arg_ptr, format);
-    int len = vsnprintf((char *)json->buffer + json->pos, json->size - json->pos, format, arg_ptr);
-    va_end(arg_ptr);
+        memcpy(json->buffer + json->pos, data, len);
+        json->pos += len;
+        data += len;
+        size -= len;
+    }
+}
 
-    if (len + json->pos > json->size - 1) {
+static void json_put(json_stream *json, char c) {
+    if (json->pos + 1 > json->size - 1)
         json_flush(json);
 
-        va_start(arg_ptr, format);
-        int len = vsnprintf((char *)json->buffer + json->pos, json->size - json->pos, format, arg_ptr);
-        va_end(arg_ptr);
-
-        if (len > json->size - 1) {
-            ERROR("Write value too large");
-            DEBUG("Format = %s", format);
-        } else {
-            json->pos += len;
-        }
-    } else {
-        json->pos += len;
-    }
+    json->buffer[json->pos++] = c;
 }
 
 void json_object_start(json_stream *json) {
@@ -102,11 +115,12 @@ void json_object_start(json_stream *json) {
 
     switch (json->state) {
         case JSON_STATE_ARRAY_ITEM:
-            json_write(json, ",");
+            json_put(json, ',');
+            // fall through
         case JSON_STATE_START:
         case JSON_STATE_OBJECT_KEY:
         case JSON_STATE_ARRAY:
-            json_write(json, "{");
+            json_put(json, '{');
 
             json->state = JSON_STATE_OBJECT;
             json->nesting[json->nesting_idx++] = JSON_NESTING_OBJECT;
@@ -125,7 +139,7 @@ void json_object_end(json_stream *json) {
     switch (json->state) {
         case JSON_STATE_OBJECT:
         case JSON_STATE_OBJECT_VALUE:
-            json_write(json, "}");
+            json_put(json, '}');
 
             json->nesting_idx--;
             if (!json->nesting_idx) {
@@ -148,17 +162,33 @@ void json_object_end(json_stream *json) {
     }
 }
 
+void json_object_resume(json_stream *json) {
+    if (json->state == JSON_STATE_ERROR)
+        return;
+
+    if (json->nesting_idx >= JSON_MAX_DEPTH) {
+        ERROR("Unexpected object resume");
+        DEBUG_STATE(json);
+        json->state = JSON_STATE_ERROR;
+        return;
+    }
+
+    json->state = JSON_STATE_OBJECT_VALUE;
+    json->nesting[json->nesting_idx++] = JSON_NESTING_OBJECT;
+}
+
 void json_array_start(json_stream *json) {
     if (json->state == JSON_STATE_ERROR)
         return;
 
     switch (json->state) {
         case JSON_STATE_ARRAY_ITEM:
-            json_write(json, ",");
+            json_put(json, ',');
+            // fall through
         case JSON_STATE_START:
         case JSON_STATE_OBJECT_KEY:
         case JSON_STATE_ARRAY:
-            json_write(json, "[");
+            json_put(json, '[');
 
             json->state = JSON_STATE_ARRAY;
             json->nesting[json->nesting_idx++] = JSON_NESTING_ARRAY;
@@ -177,7 +207,7 @@ void json_array_end(json_stream *json) {
     switch (json->state) {
         case JSON_STATE_ARRAY:
         case JSON_STATE_ARRAY_ITEM:
-            json_write(json, "]");
+            json_put(json, ']');
 
             json->nesting_idx--;
             if (!json->nesting_idx) {
@@ -200,91 +230,279 @@ void json_array_end(json_stream *json) {
     }
 }
 
-void _json_number(json_stream *json, char *value) {
+// Makes sure `size` more bytes fit into the buffer (flushing it if needed)
+// and returns where they go.
+static char *json_reserve(json_stream *json, size_t size) {
+    if (json->pos + size > json->size - 1)
+        json_flush(json);
+
+    return (char *)json->buffer + json->pos;
+}
+
+// Writes the "," before a number if needed and returns where the number
+// digits go, there is room for JSON_NUMBER_SIZE bytes. The digits are formatted
+// in place and committed with _json_number_end.
+static char *_json_number_start(json_stream *json) {
     if (json->state == JSON_STATE_ERROR)
-        return;
+        return NULL;
 
-    void _do_write() {
-        json_write(json, value);
-    }
+    char *b = json_reserve(json, 1 + JSON_NUMBER_SIZE);
 
     switch (json->state) {
         case JSON_STATE_START:
-            _do_write();
             json->state = JSON_STATE_END;
             break;
         case JSON_STATE_ARRAY_ITEM:
-            json_write(json, ",");
+            *b++ = ',';
+            json->pos++;
+            // fall through
         case JSON_STATE_ARRAY:
-            _do_write();
             json->state = JSON_STATE_ARRAY_ITEM;
             break;
         case JSON_STATE_OBJECT_KEY:
-            _do_write();
             json->state = JSON_STATE_OBJECT_VALUE;
             break;
         default:
             ERROR("Unexpected integer");
             DEBUG_STATE(json);
             json->state = JSON_STATE_ERROR;
+            return NULL;
     }
+
+    return b;
 }
 
+static void _json_number_end(json_stream *json, size_t length) {
+    json->pos += length;
+}
 
-void json_uint8(json_stream *json, uint8_t x) {
-    char buffer[4];
-    snprintf(buffer, sizeof(buffer), "%u", x);
+static size_t json_format_uint32(char *buffer, uint32_t x) {
+    char digits[10];
+    char *d = digits + sizeof(digits);
+    do {
+        *(--d) = '0' + (x % 10);
+    } while (x /= 10);
 
-    _json_number(json, buffer);
+    size_t length = digits + sizeof(digits) - d;
+    memcpy(buffer, d, length);
+    return length;
 }
 
-void json_uint16(json_stream *json, uint16_t x) {
-    char buffer[6];
-    snprintf(buffer, sizeof(buffer), "%u", x);
+static size_t json_format_uint64(char *buffer, uint64_t x) {
+    if (x <= UINT32_MAX)
+        return json_format_uint32(buffer, x);
+
+    char digits[20];
+    char *d = digits + sizeof(digits);
+    do {
+        *(--d) = '0' + (x % 10);
+    } while (x /= 10);
 
-    _json_number(json, buffer);
+    size_t length = digits + sizeof(digits) - d;
+    memcpy(buffer, d, length);
+    return length;
 }
 
-void json_uint32(json_stream *json, uint32_t x) {
-    char buffer[11];
-    snprintf(buffer, sizeof(buffer), "%u", x);
+static size_t json_format_integer(char *buffer, int x) {
+    if (x >= 0)
+        return json_format_uint32(buffer, x);
 
-    _json_number(json, buffer);
+    buffer[0] = '-';
+    return 1 + json_format_uint32(buffer + 1, -(uint32_t)x);
 }
 
-void json_uint64(json_stream *json, uint64_t x) {
-    char buffer[21];
-    buffer[20] = 0;
+static double json_pow10(int n) {
+    double result = 1;
+    while (n-- > 0)
+        result *= 10;
+    return result;
+}
 
-    char *b = &buffer[20];
-    do {
-        *(--b) = '0' + (x % 10);
-    } while (x /= 10);
+// Writes the shortest decimal that reads back as the same float, in the
+// layout of "%g" (scientific below 1e-4 and from 1e15), e.g. 0.1f is written
+// as "0.1" instead of "0.100000001490116". NaN and infinity are not valid
+// JSON numbers and are written as null.
+static size_t json_format_float(char *buffer, float x) {
+    char *b = buffer;
 
-    _json_number(json, b);
+    if (x != x || x - x != 0) {
+        memcpy(b, "null", 4);
+        return 4;
+    }
+    if (x < 0) {
+        *b++ = '-';
+        x = -x;
+    }
+    if (x == 0) {
+        *b++ = '0';
+        return b - buffer;
+    }
+
+    // 10^e <= x < 10^(e+1)
+    double v = x;
+    double power = 1;
+    int e = 0;
+    if (v >= 1) {
+        while (v >= power * 10) {
+            power *= 10;
+            e++;
+        }
+    } else {
+        while (v * power < 1) {
+            power *= 10;
+            e--;
+        }
+    }
+
+    // Fewest significant digits (at most 9 are ever needed for a float)
+    // such that x == mantissa * 10^k
+    uint32_t mantissa = 0;
+    int k = 0;
+    for (int precision = 1; precision <= 9; precision++) {
+        k = e - precision + 1;
+        double m = (k >= 0) ? v / json_pow10(k) : v * json_pow10(-k);
+        mantissa = (uint32_t)(m + 0.5);
+        double check = (k >= 0) ? mantissa * json_pow10(k) : mantissa / json_pow10(-k);
+        if ((float)check == x)
+            break;
+    }
+    while (mantissa >= 10 && mantissa % 10 == 0) {
+        mantissa /= 10;
+        k++;
+    }
+
+    char digits[10];
+    int n = json_format_uint32(digits, mantissa);
+    int exponent = n - 1 + k;
+
+    if (exponent < -4 || exponent >= 15) {
+        *b++ = digits[0];
+        if (n > 1) {
+            *b++ = '.';
+            memcpy(b, digits + 1, n - 1);
+            b += n - 1;
+        }
+        *b++ = 'e';
+        *b++ = (exponent < 0) ? '-' : '+';
+        if (exponent < 0)
+            exponent = -exponent;
+        *b++ = '0' + exponent / 10;
+        *b++ = '0' + exponent % 10;
+    } else if (k >= 0) {
+        memcpy(b, digits, n);
+        b += n;
+        memset(b, '0', k);
+        b += k;
+    } else if (exponent >= 0) {
+        memcpy(b, digits, exponent + 1);
+        b += exponent + 1;
+        *b++ = '.';
+        memcpy(b, digits + exponent + 1, n - exponent - 1);
+        b += n - exponent - 1;
+    } else {
+        *b++ = '0';
+        *b++ = '.';
+        memset(b, '0', -exponent - 1);
+        b += -exponent - 1;
+        memcpy(b, digits, n);
+        b += n;
+    }
+
+    return b - buffer;
 }
 
-void json_integer(json_stream *json, int x) {
-    char buffer[7];
-    snprintf(buffer, sizeof(buffer), "%d", x);
 
-    _json_number(json, buffer);
+void json_uint8(json_stream *json, uint8_t x) {
+    char *b = _json_number_start(json);
+    if (b)
+        _json_number_end(json, json_format_uint32(b, x));
+}
+
+void json_uint16(json_stream *json, uint16_t x) {
+    char *b = _json_number_start(json);
+    if (b)
+        _json_number_end(json, json_format_uint32(b, x));
+}
+
+void json_uint32(json_stream *json, uint32_t x) {
+    char *b = _json_number_start(json);
+    if (b)
+        _json_number_end(json, json_format_uint32(b, x));
+}
+
+void json_uint64(json_stream *json, uint64_t x) {
+    char *b = _json_number_start(json);
+    if (b)
+        _json_number_end(json, json_format_uint64(b, x));
+}
+
+void json_integer(json_stream *json, int x) {
+    char *b = _json_number_start(json);
+    if (b)
+        _json_number_end(json, json_format_integer(b, x));
 }
 
 void json_float(json_stream *json, float x) {
-    char buffer[32];
-    snprintf(buffer, sizeof(buffer), "%1.15g", x);
+    char *b = _json_number_start(json);
+    if (b)
+        _json_number_end(json, json_format_float(b, x));
+}
 
-    _json_number(json, buffer);
+// ", \ and the control characters have to be escaped in a JSON string
+static inline bool json_is_escaped(unsigned char c) {
+    return c < 0x20 || c == '"' || c == '\\';
 }
 
-void json_string(json_stream *json, const char *x) {
+static void json_write_escaped(json_stream *json, const char *x, size_t length) {
+    while (length) {
+        // Copy the run up to the next character to escape, usually the
+        // whole string, at once
+        size_t run = 0;
+        while (run < length && !json_is_escaped(x[run]))
+            run++;
+
+        json_raw(json, (const uint8_t *)x, run);
+        x += run;
+        length -= run;
+        if (!length)
+            break;
+
+        unsigned char c = *x++;
+        length--;
+
+        uint8_t escape[6] = {'\\'};
+        size_t escape_size = 2;
+        switch (c) {
+            case '"': escape[1] = '"'; break;
+            case '\\': escape[1] = '\\'; break;
+            case '\b': escape[1] = 'b'; break;
+            case '\f': escape[1] = 'f'; break;
+            case '\n': escape[1] = 'n'; break;
+            case '\r': escape[1] = 'r'; break;
+            case '\t': escape[1] = 't'; break;
+            default:
+                escape[1] = 'u';
+                escape[2] = '0';
+                escape[3] = '0';
+                escape[4] = "0123456789abcdef"[c >> 4];
+                escape[5] = "0123456789abcdef"[c & 0xf];
+                escape_size = 6;
+        }
+        json_raw(json, escape, escape_size);
+    }
+}
+
+static void _json_string(json_stream *json, const char *x, size_t length, bool escaped) {
     if (json->state == JSON_STATE_ERROR)
         return;
 
     void _do_write() {
-        // TODO: escape string
-        json_write(json, "\"%s\"", x);
+        json_put(json, '"');
+        if (escaped)
+            json_raw(json, (const uint8_t *)x, length);
+        else
+            json_write_escaped(json, x, length);
+        json_put(json, '"');
     }
 
     switch (json->state) {
@@ -293,16 +511,18 @@ void json_string(json_stream *json, const char *x) {
             json->state = JSON_STATE_END;
             break;
         case JSON_STATE_ARRAY_ITEM:
-            json_write(json, ",");
+            json_put(json, ',');
+            // fall through
         case JSON_STATE_ARRAY:
             _do_write();
             json->state = JSON_STATE_ARRAY_ITEM;
             break;
         case JSON_STATE_OBJECT_VALUE:
-            json_write(json, ",");
+            json_put(json, ',');
+            // fall through
         case JSON_STATE_OBJECT:
             _do_write();
-            json_write(json, ":");
+            json_put(json, ':');
             json->state = JSON_STATE_OBJECT_KEY;
             break;
         case JSON_STATE_OBJECT_KEY:
@@ -316,12 +536,30 @@ void json_string(json_stream *json, const char *x) {
     }
 }
 
+void json_string(json_stream *json, const char *x) {
+    if (!x)
+        x = "";
+
+    _json_string(json, x, strlen(x), false);
+}
+
+void json_string_n(json_stream *json, const char *x, size_t length) {
+    _json_string(json, x, length, false);
+}
+
+void json_string_escaped(json_stream *json, const char *x, size_t length) {
+    _json_string(json, x, length, true);
+}
+
 void json_boolean(json_stream *json, bool x) {
     if (json->state == JSON_STATE_ERROR)
         return;
 
     void _do_write() {
-        json_write(json, (x) ? "true" : "false");
+        if (x)
+            json_raw(json, (const uint8_t *)"true", 4);
+        else
+            json_raw(json, (const uint8_t *)"false", 5);
     }
 
     switch (json->state) {
@@ -330,7 +568,8 @@ void json_boolean(json_stream *json, bool x) {
             json->state = JSON_STATE_END;
             break;
         case JSON_STATE_ARRAY_ITEM:
-            json_write(json, ",");
+            json_put(json, ',');
+            // fall through
         case JSON_STATE_ARRAY:
             _do_write();
             json->state = JSON_STATE_ARRAY_ITEM;
@@ -351,7 +590,7 @@ void json_null(json_stream *json) {
         return;
 
     void _do_write() {
-        json_write(json, "null");
+        json_raw(json, (const uint8_t *)"null", 4);
     }
 
     switch (json->state) {
@@ -360,7 +599,8 @@ void json_null(json_stream *json) {
             json->state = JSON_STATE_END;
             break;
         case JSON_STATE_ARRAY_ITEM:
-            json_write(json, ",");
+            json_put(json, ',');
+            // fall through
         case JSON_STATE_ARRAY:
             _do_write();
             json->state = JSON_STATE_ARRAY_ITEM;
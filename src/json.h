@@ -5,6 +5,12 @@ extern "C" {
 #endif
 
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Longest number written by the json_uint*, json_integer and json_float,
+// e.g. "18446744073709551615" or "-1.17549435e-38"
+#define JSON_NUMBER_SIZE 24
 
 struct json_stream;
 typedef struct json_stream json_stream;
@@ -12,6 +18,11 @@ typedef struct json_stream json_stream;
 typedef void (*json_flush_callback)(uint8_t *buffer, size_t size, void *context);
 
 json_stream *json_new(size_t buffer_size, json_flush_callback on_flush, void *context);
+// Initializes a stream of json_stream_size() bytes owned by the caller, with a buffer
+// of at least JSON_NUMBER_SIZE + 2 bytes. json_free is not called for it.
+void json_init(json_stream *json, uint8_t *buffer, size_t buffer_size,
+               json_flush_callback on_flush, void *context);
+size_t json_stream_size();
 void json_free(json_stream *json);
 
 void json_flush(json_stream *json);
@@ -29,9 +40,22 @@ void json_uint32(json_stream *json, uint32_t x);
 void json_uint64(json_stream *json, uint64_t x);
 void json_float(json_stream *json, float x);
 void json_string(json_stream *json, const char *x);
+// Same as json_string for a string of known length, which may contain '\0'.
+void json_string_n(json_stream *json, const char *x, size_t length);
+// Write a string that is already escaped (or needs no escaping) as is.
+void json_string_escaped(json_stream *json, const char *x, size_t length);
+// Write a string literal such as an object key, its length is known at
+// compile time and it is not scanned for characters to escape.
+#define json_key(json, key) json_string_escaped(json, "" key "", sizeof(key) - 1)
 void json_boolean(json_stream *json, bool x);
 void json_null(json_stream *json);
 
+// Write a pre-rendered piece of JSON as is, the stream state is not changed.
+void json_raw(json_stream *json, const uint8_t *data, size_t size);
+// Continue an object whose "{" and some members were written with json_raw,
+// the next json_string is a key. Close it with json_object_end.
+void json_object_resume(json_stream *json);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,335 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "json_parser.h"
+
+#include "homekit_debug.h"
+
+// At most 32, the containers are kept as bits of json_parser.objects
+#define JSON_PARSER_MAX_DEPTH 30
+// Longest number, e.g. "-1.7976931348623157e+308"
+#define JSON_PARSER_NUMBER_SIZE 32
+
+// What json_parser_next accepts next
+enum {
+    JSON_PARSER_VALUE = 0,      // a value: at the start, after ":" or after "," in an array
+    JSON_PARSER_VALUE_OR_END,   // a value or "]": after "["
+    JSON_PARSER_KEY,            // a string: after "," in an object
+    JSON_PARSER_KEY_OR_END,     // a string or "}": after "{"
+    JSON_PARSER_COLON,          // ":" then a value: after a key
+    JSON_PARSER_NEXT,           // "," or the end of the container: after a value
+    JSON_PARSER_DONE,           // nothing: after the top level value
+    JSON_PARSER_ERROR,
+};
+
+void json_parser_init(json_parser *parser, char *data, size_t size) {
+    parser->data = data;
+    parser->pos = data;
+    parser->end = data + size;
+    parser->objects = 0;
+    parser->depth = 0;
+    parser->state = JSON_PARSER_VALUE;
+}
+
+static void json_parser_skip_whitespace(json_parser *parser) {
+    while (parser->pos < parser->end) {
+        char c = *parser->pos;
+        if (c != ' ' && c != '\t' && c != '\r' && c != '\n')
+            break;
+        parser->pos++;
+    }
+}
+
+static bool json_parser_in_object(const json_parser *parser) {
+    return parser->depth && (parser->objects & (1UL << (parser->depth - 1)));
+}
+
+// Reads the separator the state asks for, returns false if it is missing
+static bool json_parser_separator(json_parser *parser) {
+    char c = (parser->pos < parser->end) ? *parser->pos : 0;
+    switch (parser->state) {
+        case JSON_PARSER_COLON:
+            if (c != ':')
+                return false;
+            parser->pos++;
+            parser->state = JSON_PARSER_VALUE;
+            break;
+        case JSON_PARSER_NEXT:
+            if (c == ',') {
+                parser->pos++;
+                parser->state = json_parser_in_object(parser) ? JSON_PARSER_KEY : JSON_PARSER_VALUE;
+            } else if (c != (json_parser_in_object(parser) ? '}' : ']')) {
+                return false;
+            }
+            break;
+        default:
+            return true;
+    }
+    json_parser_skip_whitespace(parser);
+    return true;
+}
+
+// Checks that token fits the state and moves to the next state
+static bool json_parser_accept(json_parser *parser, json_token_type type) {
+    bool is_end = (type == JSON_TOKEN_OBJECT_END || type == JSON_TOKEN_ARRAY_END);
+
+    switch (parser->state) {
+        case JSON_PARSER_KEY_OR_END:
+            if (type == JSON_TOKEN_OBJECT_END)
+                break;
+            // fall through
+        case JSON_PARSER_KEY:
+            if (type != JSON_TOKEN_STRING)
+                return false;
+            parser->state = JSON_PARSER_COLON;
+            return true;
+        case JSON_PARSER_VALUE_OR_END:
+            if (type == JSON_TOKEN_ARRAY_END)
+                break;
+            // fall through
+        case JSON_PARSER_VALUE:
+            if (is_end)
+                return false;
+            break;
+        case JSON_PARSER_NEXT:
+            // json_parser_separator let only the matching end through
+            break;
+        default:
+            return false;
+    }
+
+    if (type == JSON_TOKEN_OBJECT_START || type == JSON_TOKEN_ARRAY_START) {
+        if (parser->depth == JSON_PARSER_MAX_DEPTH)
+            return false;
+        if (type == JSON_TOKEN_OBJECT_START) {
+            parser->objects |= 1UL << parser->depth;
+            parser->state = JSON_PARSER_KEY_OR_END;
+        } else {
+            parser->objects &= ~(1UL << parser->depth);
+            parser->state = JSON_PARSER_VALUE_OR_END;
+        }
+        parser->depth++;
+        return true;
+    }
+
+    if (is_end)
+        parser->depth--;
+    parser->state = parser->depth ? JSON_PARSER_NEXT : JSON_PARSER_DONE;
+    return true;
+}
+
+static int json_parser_hex(char c) {
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+    return -1;
+}
+
+static json_token_type json_parser_string(json_parser *parser, json_token *token) {
+    char *src = parser->pos + 1; // after the opening quote
+    char *dst = src;
+    token->string = src;
+
+    while (src < parser->end && *src != '"') {
+        char c = *src++;
+        if ((uint8_t) c < 0x20)
+            return JSON_TOKEN_ERROR;
+
+        if (c != '\\') {
+            *dst++ = c;
+            continue;
+        }
+
+        if (src >= parser->end)
+            return JSON_TOKEN_ERROR;
+
+        switch (*src++) {
+            case '"': *dst++ = '"'; break;
+            case '\\': *dst++ = '\\'; break;
+            case '/': *dst++ = '/'; break;
+            case 'b': *dst++ = '\b'; break;
+            case 'f': *dst++ = '\f'; break;
+            case 'n': *dst++ = '\n'; break;
+            case 'r': *dst++ = '\r'; break;
+            case 't': *dst++ = '\t'; break;
+            case 'u': {
+                if (parser->end - src < 4)
+                    return JSON_TOKEN_ERROR;
+                uint32_t code = 0;
+                for (int i = 0; i < 4; i++) {
+                    int h = json_parser_hex(*src++);
+                    if (h < 0)
+                        return JSON_TOKEN_ERROR;
+                    code = (code << 4) | h;
+                }
+                // UTF-8, never longer than the 6 byte escape sequence
+                // (surrogate pairs are kept as two 3 byte sequences)
+                if (code < 0x80) {
+                    *dst++ = code;
+                } else if (code < 0x800) {
+                    *dst++ = 0xC0 | (code >> 6);
+                    *dst++ = 0x80 | (code & 0x3F);
+                } else {
+                    *dst++ = 0xE0 | (code >> 12);
+                    *dst++ = 0x80 | ((code >> 6) & 0x3F);
+                    *dst++ = 0x80 | (code & 0x3F);
+                }
+                break;
+            }
+            default:
+                return JSON_TOKEN_ERROR;
+        }
+    }
+
+    if (src >= parser->end)
+        return JSON_TOKEN_ERROR;
+
+    *dst = 0; // dst <= src, the closing quote is already read
+    token->length = dst - token->string;
+    parser->pos = src + 1;
+    return JSON_TOKEN_STRING;
+}
+
+static bool json_parser_is_number(char c) {
+    return (c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.' || c == 'e' || c == 'E';
+}
+
+static json_token_type json_parser_number(json_parser *parser, json_token *token) {
+    // strtod needs a terminated string, the number is copied since the
+    // buffer may go on with other data (the next request)
+    char number[JSON_PARSER_NUMBER_SIZE + 1];
+    size_t length = 0;
+    while (parser->pos + length < parser->end && json_parser_is_number(parser->pos[length])) {
+        if (length == JSON_PARSER_NUMBER_SIZE)
+            return JSON_TOKEN_ERROR;
+        number[length] = parser->pos[length];
+        length++;
+    }
+    number[length] = 0;
+
+    char *end;
+    token->number = strtod(number, &end);
+    if (end == number)
+        return JSON_TOKEN_ERROR;
+
+    parser->pos += end - number;
+    return JSON_TOKEN_NUMBER;
+}
+
+static json_token_type json_parser_literal(json_parser *parser, const char *literal,
+                                           json_token_type type) {
+    size_t len = strlen(literal);
+    if ((size_t) (parser->end - parser->pos) < len || strncmp(parser->pos, literal, len))
+        return JSON_TOKEN_ERROR;
+
+    parser->pos += len;
+    return type;
+}
+
+// Reads the token at parser->pos, the structure is not checked here
+static json_token_type json_parser_token(json_parser *parser, json_token *token) {
+    switch (*parser->pos) {
+        case '{':
+            parser->pos++;
+            return JSON_TOKEN_OBJECT_START;
+        case '}':
+            parser->pos++;
+            return JSON_TOKEN_OBJECT_END;
+        case '[':
+            parser->pos++;
+            return JSON_TOKEN_ARRAY_START;
+        case ']':
+            parser->pos++;
+            return JSON_TOKEN_ARRAY_END;
+        case '"':
+            return json_parser_string(parser, token);
+        case 't':
+            return json_parser_literal(parser, "true", JSON_TOKEN_TRUE);
+        case 'f':
+            return json_parser_literal(parser, "false", JSON_TOKEN_FALSE);
+        case 'n':
+            return json_parser_literal(parser, "null", JSON_TOKEN_NULL);
+        default:
+            if (*parser->pos == '-' || (*parser->pos >= '0' && *parser->pos <= '9')) {
+                return json_parser_number(parser, token);
+            }
+            return JSON_TOKEN_ERROR;
+    }
+}
+
+json_token_type json_parser_next(json_parser *parser, json_token *token) {
+    token->string = NULL;
+    token->length = 0;
+
+    if (parser->state == JSON_PARSER_ERROR) {
+        token->type = JSON_TOKEN_ERROR;
+        return token->type;
+    }
+
+    json_parser_skip_whitespace(parser);
+    char *start = parser->pos;
+
+    if (!json_parser_separator(parser)) {
+        token->type = JSON_TOKEN_ERROR;
+    } else if (parser->pos >= parser->end || !*parser->pos) {
+        if (parser->state == JSON_PARSER_DONE) {
+            token->type = JSON_TOKEN_END;
+            return token->type;
+        }
+        token->type = JSON_TOKEN_ERROR; // only the top level value may end here
+    } else {
+        token->type = json_parser_token(parser, token);
+    }
+
+    if (token->type != JSON_TOKEN_ERROR && !json_parser_accept(parser, token->type))
+        token->type = JSON_TOKEN_ERROR;
+
+    if (token->type == JSON_TOKEN_ERROR) {
+        // Stay at the offending token
+        parser->pos = start;
+        parser->state = JSON_PARSER_ERROR;
+        DEBUG("Unexpected JSON at offset %d", (int) (parser->pos - parser->data));
+    }
+    return token->type;
+}
+
+bool json_parser_skip(json_parser *parser, const json_token *token) {
+    switch (token->type) {
+        case JSON_TOKEN_OBJECT_START:
+        case JSON_TOKEN_ARRAY_START:
+            break;
+        case JSON_TOKEN_STRING:
+        case JSON_TOKEN_NUMBER:
+        case JSON_TOKEN_TRUE:
+        case JSON_TOKEN_FALSE:
+        case JSON_TOKEN_NULL:
+            return true;
+        default:
+            return false; // not a value
+    }
+
+    int depth = 1;
+    json_token t;
+    while (depth) {
+        switch (json_parser_next(parser, &t)) {
+            case JSON_TOKEN_OBJECT_START:
+            case JSON_TOKEN_ARRAY_START:
+                if (++depth > JSON_PARSER_MAX_DEPTH)
+                    return false;
+                break;
+            case JSON_TOKEN_OBJECT_END:
+            case JSON_TOKEN_ARRAY_END:
+                depth--;
+                break;
+            case JSON_TOKEN_ERROR:
+            case JSON_TOKEN_END:
+                return false;
+            default:
+                break;
+        }
+    }
+    return true;
+}
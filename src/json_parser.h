@@ -0,0 +1,58 @@
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Pull parser working in place on a mutable buffer: no allocations,
+// strings are unescaped and NUL-terminated inside the buffer.
+// Nothing is read past data + size, the buffer needs not be NUL-terminated.
+// The structure is checked as the tokens are read: a missing, duplicated or
+// misplaced "," or ":", a key that is not a string or an unmatched bracket
+// gives JSON_TOKEN_ERROR, and so does every call after it.
+
+typedef enum {
+    JSON_TOKEN_ERROR = 0,
+    JSON_TOKEN_END,
+    JSON_TOKEN_OBJECT_START,
+    JSON_TOKEN_OBJECT_END,
+    JSON_TOKEN_ARRAY_START,
+    JSON_TOKEN_ARRAY_END,
+    JSON_TOKEN_STRING,
+    JSON_TOKEN_NUMBER,
+    JSON_TOKEN_TRUE,
+    JSON_TOKEN_FALSE,
+    JSON_TOKEN_NULL,
+} json_token_type;
+
+typedef struct {
+    json_token_type type;
+    char *string;  // JSON_TOKEN_STRING
+    size_t length;
+    double number; // JSON_TOKEN_NUMBER
+} json_token;
+
+typedef struct {
+    char *data;
+    char *pos;
+    char *end;
+    uint32_t objects; // bit n is set if the container at depth n + 1 is an object
+    uint8_t depth;
+    uint8_t state;
+} json_parser;
+
+void json_parser_init(json_parser *parser, char *data, size_t size);
+
+// Reads the next token, returns its type
+json_token_type json_parser_next(json_parser *parser, json_token *token);
+
+// Skips the value starting with token (the whole object or array), returns false on error
+bool json_parser_skip(json_parser *parser, const json_token *token);
+
+#ifdef __cplusplus
+}
+#endif
@@ -132,10 +132,157 @@ void homekit_mdns_add_txt(const char *key, const char *format, ...) {
 }
 
 void homekit_mdns_configure_finalize() {
-    /*
-    printf("mDNS announcement: Name=%s %s Port=%d TTL=%d\n",
-           name->value.string_value, txt_rec, PORT, 0);
-    */
-//}*/
+    //printf("mDNS announcement: Name=%s %s Port=%d TTL=%d\n",
+    //       name->value.string_value, txt_rec, PORT, 0);
+}
+*/
+
+#endif
+
+#if !defined(ESP_OPEN_RTOS) && !defined(ARDUINO_ARCH_ESP8266)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+#include "port.h"
+
+// The emulated flash is a plain file, all-0xFF after erase.
+// Writes can only clear bits (like the NOR flash of ESP8266).
+#ifndef HOMEKIT_HOST_FLASH_FILE
+#define HOMEKIT_HOST_FLASH_FILE "homekit_flash.bin"
+#endif
+
+uint32_t homekit_random() {
+	uint32_t x;
+	homekit_random_fill((uint8_t *) &x, sizeof(x));
+	return x;
+}
+
+void homekit_random_fill(uint8_t *data, size_t size) {
+	FILE *f = fopen("/dev/urandom", "rb");
+	if (f) {
+		size_t r = fread(data, 1, size, f);
+		fclose(f);
+		if (r == size)
+			return;
+	}
+	for (size_t i = 0; i < size; i++) {
+		data[i] = rand();
+	}
+}
+
+void homekit_system_restart() {
+	exit(0);
+}
+
+void homekit_overclock_start() {
+}
+
+void homekit_overclock_end() {
+}
+
+uint32_t millis() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint32_t) (ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+}
+
+void yield() {
+}
+
+// The free heap is this nominal size less what the process has in use (mallinfo),
+// so that the heap logs and the benchmarks show the memory taken and freed. It is
+// larger than the ~50KB of an ESP8266 sketch since the host allocations (stdio,
+// 64-bit pointers) are larger too.
+#ifndef HOMEKIT_HOST_HEAP_SIZE
+#define HOMEKIT_HOST_HEAP_SIZE (1024 * 1024)
+#endif
+
+uint32_t system_get_free_heap_size() {
+#if defined(__GLIBC__)
+#if __GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33)
+	size_t used = mallinfo2().uordblks;
+#else
+	size_t used = (unsigned) mallinfo().uordblks;
+#endif
+	return used < HOMEKIT_HOST_HEAP_SIZE ? HOMEKIT_HOST_HEAP_SIZE - used : 0;
+#else
+	return HOMEKIT_HOST_HEAP_SIZE;
+#endif
+}
+
+static FILE *host_flash_open() {
+	FILE *f = fopen(HOMEKIT_HOST_FLASH_FILE, "r+b");
+	if (!f)
+		f = fopen(HOMEKIT_HOST_FLASH_FILE, "w+b");
+	return f;
+}
+
+bool spiflash_read(uint32_t addr, uint8_t *buffer, uint32_t size) {
+	FILE *f = host_flash_open();
+	if (!f)
+		return false;
+	memset(buffer, 0xFF, size);
+	if (fseek(f, addr, SEEK_SET) == 0) {
+		fread(buffer, 1, size, f);
+	}
+	fclose(f);
+	return true;
+}
+
+bool spiflash_write(uint32_t addr, const uint8_t *data, uint32_t size) {
+	uint8_t *buffer = malloc(size);
+	if (!buffer)
+		return false;
+	if (!spiflash_read(addr, buffer, size)) {
+		free(buffer);
+		return false;
+	}
+	for (uint32_t i = 0; i < size; i++) {
+		buffer[i] &= data[i];
+	}
+
+	FILE *f = host_flash_open();
+	bool ok = false;
+	if (f) {
+		// Pad with 0xFF (erased) if the file is shorter than addr
+		fseek(f, 0, SEEK_END);
+		long end = ftell(f);
+		while (end >= 0 && end < (long) addr) {
+			fputc(0xFF, f);
+			end++;
+		}
+		ok = fseek(f, addr, SEEK_SET) == 0
+				&& fwrite(buffer, 1, size, f) == size;
+		fclose(f);
+	}
+	free(buffer);
+	return ok;
+}
+
+bool spiflash_erase_sector(uint32_t addr) {
+	uint8_t erased[SPI_FLASH_SECTOR_SIZE];
+	memset(erased, 0xFF, sizeof(erased));
+
+	addr -= addr % SPI_FLASH_SECTOR_SIZE;
+	FILE *f = host_flash_open();
+	if (!f)
+		return false;
+	fseek(f, 0, SEEK_END);
+	long end = ftell(f);
+	while (end >= 0 && end < (long) addr) {
+		fputc(0xFF, f);
+		end++;
+	}
+	bool ok = fseek(f, addr, SEEK_SET) == 0
+			&& fwrite(erased, 1, sizeof(erased), f) == sizeof(erased);
+	fclose(f);
+	return ok;
+}
 
 #endif
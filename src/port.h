@@ -5,6 +5,7 @@ extern "C" {
 #endif
 
 #include <stdint.h>
+#include <stddef.h>
 
 uint32_t homekit_random();
 void homekit_random_fill(uint8_t *data, size_t size);
@@ -38,6 +39,24 @@ void homekit_overclock_end();
 #define spiflash_erase_sector(addr) (spi_flash_erase_sector((addr) / SPI_FLASH_SECTOR_SIZE) == ESP_OK)
 #endif
 
+#if !defined(ESP_OPEN_RTOS) && !defined(ARDUINO_ARCH_ESP8266)
+// Host (POSIX) port, used to build and profile the C core on a PC.
+// The flash is emulated by a file, see HOMEKIT_HOST_FLASH_FILE in port.c
+#include <stdbool.h>
+
+#define ESP_OK 0
+
+#define SPI_FLASH_SECTOR_SIZE 4096
+
+bool spiflash_read(uint32_t addr, uint8_t *buffer, uint32_t size);
+bool spiflash_write(uint32_t addr, const uint8_t *data, uint32_t size);
+bool spiflash_erase_sector(uint32_t addr);
+
+uint32_t millis();
+void yield();
+uint32_t system_get_free_heap_size();
+#endif
+
 
 #ifdef ESP_IDF
 #define SERVER_TASK_STACK 12288
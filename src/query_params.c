@@ -38,6 +38,48 @@ query_param_t *query_params_parse(const char *s) {
 }
 
 
+query_param_t *query_params_parse_in_place(char *s, arena_t *arena) {
+    query_param_t *params = NULL;
+
+    int i = 0;
+    while (s[i] && s[i] != '#') {
+        int pos = i;
+        while (s[i] && s[i] != '=' && s[i] != '&' && s[i] != '#') i++;
+        if (i == pos) {
+            i++;
+            continue;
+        }
+
+        query_param_t *param = arena_alloc(arena, sizeof(query_param_t));
+        if (!param)
+            break;
+        param->name = s+pos;
+        param->value = NULL;
+        param->next = params;
+        params = param;
+
+        char c = s[i];
+        s[i] = 0;
+        if (c == '=') {
+            i++;
+            pos = i;
+            while (s[i] && s[i] != '&' && s[i] != '#') i++;
+            if (i != pos) {
+                param->value = s+pos;
+            }
+            c = s[i];
+            s[i] = 0;
+        }
+
+        if (c != '&')
+            break;
+        i++;
+    }
+
+    return params;
+}
+
+
 query_param_t *query_params_find(query_param_t *params, const char *name) {
     while (params) {
         if (!strcmp(params->name, name))
@@ -5,6 +5,8 @@
 extern "C" {
 #endif
 
+#include "arena.h"
+
 typedef struct _query_param {
     char *name;
     char *value;
@@ -13,6 +15,9 @@ typedef struct _query_param {
 } query_param_t;
 
 query_param_t *query_params_parse(const char *s);
+// Parses s in place, terminating the names and values in it, with the params
+// allocated in the arena. They are released with the arena, not query_params_free.
+query_param_t *query_params_parse_in_place(char *s, arena_t *arena);
 query_param_t *query_params_find(query_param_t *params, const char *name);
 void query_params_free(query_param_t *params);
 
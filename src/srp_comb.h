@@ -0,0 +1,1039 @@
+#pragma once
+
+// Fixed-base comb of the SRP generator g = 5 modulo N, included by crypto.c
+// (walked by srp_exptmod_step when e->comb is set), generated offline by:
+//
+//   d = ceil(SRP_COMB_BITS / SRP_COMB_TEETH)
+//   for v in range(1, 2 ** SRP_COMB_TEETH):
+//       e = sum(1 << (j * d) for j in range(SRP_COMB_TEETH) if v >> j & 1)
+//       srp_comb[v - 1] = pow(5, e, N) * 2 ** 3072 % N  (Montgomery form, big-endian)
+
+#define SRP_COMB_BITS 256
+#define SRP_COMB_TEETH 5
+#define SRP_COMB_SPACING 52
+
+const byte PROGMEM srp_comb[] = {
+  // 1
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x12, 0xb0, 0xba, 0xd5,
+  0x58, 0xf4, 0x34, 0xf8, 0x28, 0x20, 0x13, 0x46, 0x7b, 0xb3, 0x6f, 0xea,
+  0x32, 0xf4, 0x79, 0xd5, 0x4b, 0xf9, 0x01, 0xbb, 0xf5, 0xc5, 0x46, 0xc0,
+  0xd8, 0x9d, 0xf8, 0x54, 0x69, 0x8d, 0xd5, 0xa0, 0x38, 0xfb, 0xe7, 0xaa,
+  0x52, 0x16, 0x7f, 0x7c, 0xfd, 0xdc, 0xb0, 0x78, 0x0f, 0x28, 0xcb, 0xda,
+  0x44, 0x24, 0x9a, 0xeb, 0x70, 0x99, 0xf4, 0xdc, 0xdd, 0x67, 0x34, 0xa2,
+  0x89, 0x63, 0x74, 0xb0, 0x14, 0x27, 0x86, 0x1d, 0x3a, 0x82, 0xb1, 0x6f,
+  0xc0, 0xe8, 0x5c, 0xe8, 0xc4, 0x03, 0x30, 0x6d, 0x3b, 0xde, 0x68, 0x5a,
+  0x58, 0xe5, 0xe4, 0x17, 0x3b, 0x4f, 0xe1, 0xc3, 0x96, 0xe4, 0x4b, 0xa8,
+  0x92, 0x88, 0x60, 0x80, 0x92, 0x36, 0x00, 0x66, 0x5f, 0x8a, 0x37, 0xcb,
+  0x35, 0xfd, 0x90, 0x64, 0xd9, 0x0d, 0x44, 0xe4, 0x03, 0xbc, 0x96, 0xf1,
+  0x72, 0x52, 0xdd, 0xfb, 0xf2, 0x90, 0xc1, 0xb3, 0x0e, 0x47, 0xf3, 0x22,
+  0x6f, 0x05, 0x2e, 0x4c, 0xb0, 0xcd, 0x9c, 0x11, 0x72, 0x11, 0x3f, 0x51,
+  0x5d, 0x65, 0x62, 0x55, 0xe5, 0xd6, 0x32, 0xda, 0xcd, 0x0f, 0x0f, 0xdc,
+  0xfc, 0xc2, 0xf5, 0x78, 0x8a, 0x51, 0x07, 0xe7, 0x48, 0xb9, 0xe3, 0xd4,
+  0x0d, 0x87, 0x58, 0x93, 0x03, 0x2e, 0x28, 0xa1, 0x18, 0xed, 0xf8, 0xd4,
+  0x8d, 0xe7, 0xac, 0x23, 0x87, 0xb7, 0x61, 0xed, 0xf8, 0x3a, 0x6d, 0xd1,
+  0x63, 0xd9, 0xd3, 0x31, 0x73, 0x25, 0x2a, 0x4d, 0xd3, 0x82, 0x62, 0x0e,
+  0xa9, 0x25, 0x04, 0x2f, 0x15, 0x47, 0x8c, 0x86, 0xe0, 0x15, 0x90, 0x8f,
+  0x6b, 0x14, 0xe9, 0x86, 0x92, 0xe5, 0x41, 0x85, 0x03, 0x1d, 0xe6, 0xaf,
+  0x94, 0xc3, 0x38, 0x3b, 0x4a, 0xaa, 0x2b, 0x1b, 0x9e, 0x00, 0x8c, 0xbe,
+  0xea, 0x6d, 0x9c, 0xfd, 0xb6, 0x56, 0x57, 0xa4, 0xa4, 0x70, 0x5c, 0x07,
+  0x5f, 0x16, 0x66, 0xea, 0x43, 0xb4, 0x54, 0xcb, 0x49, 0x6b, 0xc9, 0x4b,
+  0x2e, 0xe1, 0xc1, 0x8b, 0x7e, 0x0c, 0xb2, 0x63, 0xbd, 0x96, 0x88, 0x19,
+  0xa4, 0x33, 0x97, 0x3f, 0xb8, 0xd1, 0xfc, 0xcc, 0x67, 0x41, 0x17, 0x9e,
+  0x8d, 0x45, 0x17, 0xea, 0xf5, 0x8c, 0xe5, 0x41, 0x79, 0xe1, 0x57, 0xe4,
+  0x4a, 0x10, 0x1d, 0xdd, 0xc0, 0x4d, 0xd6, 0x07, 0xc5, 0xb1, 0xf3, 0xbf,
+  0xc6, 0x15, 0xec, 0x0a, 0x65, 0x64, 0x28, 0x87, 0x8a, 0x98, 0x5f, 0xc0,
+  0x54, 0x9a, 0x8b, 0x4a, 0x9c, 0x19, 0x2c, 0xe1, 0xac, 0xd0, 0x54, 0x3c,
+  0x59, 0xc1, 0x9d, 0x95, 0xd3, 0x94, 0x71, 0xdd, 0xb7, 0x83, 0xa8, 0x09,
+  0xac, 0xb7, 0x34, 0x0f, 0x9b, 0x0e, 0xad, 0x38, 0x86, 0x71, 0xea, 0x5c,
+  0xb1, 0xd9, 0xe2, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+  // 2
+  0xd6, 0x05, 0x0c, 0xdd, 0x8a, 0x8a, 0x8d, 0x48, 0x1e, 0x9c, 0x6d, 0x15,
+  0x6b, 0x60, 0x9a, 0x70, 0xdc, 0xd0, 0xd9, 0x61, 0x3c, 0xbe, 0x0f, 0x64,
+  0x84, 0x52, 0x89, 0x37, 0x73, 0xd2, 0x74, 0x40, 0xc7, 0x15, 0x0e, 0x57,
+  0x11, 0x2e, 0x39, 0xbb, 0xec, 0x94, 0x6f, 0x03, 0xf0, 0xce, 0x25, 0xeb,
+  0x4a, 0xb5, 0xf6, 0x6b, 0xed, 0x1d, 0x9f, 0x1d, 0x31, 0x11, 0x9c, 0x2c,
+  0xe1, 0xae, 0xfa, 0xa8, 0xa1, 0xdd, 0x12, 0x8e, 0x53, 0xc9, 0xb2, 0x34,
+  0x3d, 0x39, 0x7b, 0x22, 0xd8, 0xc2, 0x34, 0x6e, 0xf5, 0x0a, 0x47, 0xee,
+  0x25, 0xbd, 0xc2, 0x4d, 0xa4, 0x07, 0xbe, 0x27, 0x14, 0xee, 0x86, 0x81,
+  0x7a, 0x60, 0xc6, 0x17, 0x80, 0xf0, 0x94, 0x74, 0x1b, 0x25, 0x94, 0x77,
+  0xf6, 0x22, 0x4a, 0xae, 0xb6, 0xed, 0xc5, 0xcf, 0x9c, 0x13, 0x44, 0x87,
+  0xde, 0xb9, 0x5a, 0xad, 0xdd, 0x6f, 0x9e, 0x39, 0x56, 0xca, 0x84, 0x10,
+  0xa5, 0xf2, 0x53, 0x90, 0x5e, 0x35, 0x58, 0xa5, 0xa4, 0x44, 0xcf, 0xb9,
+  0xb3, 0xf5, 0xae, 0xf1, 0x4d, 0x0e, 0x55, 0x9b, 0x33, 0x54, 0x7e, 0x7a,
+  0xaf, 0xbb, 0x26, 0xd5, 0x8e, 0xb3, 0xc3, 0x99, 0x9b, 0x50, 0xe5, 0x79,
+  0x58, 0xfd, 0x25, 0x35, 0x1b, 0xb6, 0x21, 0x42, 0xa8, 0x18, 0x3a, 0x7f,
+  0x55, 0xbd, 0x15, 0x77, 0x56, 0x86, 0x17, 0x6a, 0x2c, 0xbe, 0x82, 0xf4,
+  0xd7, 0xc2, 0xe4, 0x0e, 0xca, 0x70, 0xfc, 0xfc, 0xdd, 0x24, 0x35, 0x37,
+  0x91, 0x0d, 0x80, 0xcf, 0x90, 0x3f, 0xf4, 0xc9, 0x25, 0x2c, 0x44, 0x4d,
+  0xf3, 0xe3, 0xc7, 0xcb, 0x9c, 0x53, 0xbd, 0xa1, 0xe2, 0x2e, 0x6d, 0x87,
+  0xa8, 0x49, 0x74, 0x86, 0xe9, 0x23, 0xc0, 0x9e, 0x3b, 0x5d, 0xb9, 0x43,
+  0x69, 0xba, 0x16, 0xde, 0xe0, 0xb4, 0x3c, 0x2e, 0x6c, 0xe2, 0xe0, 0xa2,
+  0xda, 0xe6, 0x23, 0xca, 0x33, 0x98, 0x2f, 0x5d, 0x99, 0x13, 0x7c, 0xf8,
+  0xc0, 0xd5, 0x2c, 0x4d, 0x9f, 0x69, 0x68, 0x5b, 0x64, 0xd4, 0x3f, 0x2c,
+  0x35, 0x07, 0x36, 0x96, 0x29, 0xfe, 0x39, 0x59, 0x85, 0x5e, 0xcd, 0xa1,
+  0x15, 0x5e, 0xbd, 0xc4, 0xbd, 0xa6, 0x0b, 0xf7, 0x8a, 0xfd, 0x8c, 0x4a,
+  0x07, 0x41, 0xfc, 0xd7, 0xb0, 0x66, 0xc2, 0xa5, 0x33, 0xed, 0xda, 0x06,
+  0x84, 0x94, 0x85, 0x34, 0xdf, 0x7b, 0xa4, 0x51, 0x0f, 0x7a, 0xd8, 0x88,
+  0x9d, 0xfe, 0xbb, 0xb9, 0x2b, 0x84, 0x09, 0x9b, 0x10, 0xdc, 0x14, 0x12,
+  0x8b, 0x11, 0x4c, 0x7b, 0x0d, 0x92, 0x30, 0x04, 0xbc, 0x16, 0x48, 0x46,
+  0x55, 0x64, 0xf1, 0xcc, 0x26, 0x4d, 0xed, 0x25, 0x15, 0x7e, 0xb1, 0x12,
+  0xf7, 0x37, 0xde, 0xa5, 0x89, 0xfd, 0xbf, 0xbc, 0x77, 0x36, 0x20, 0x32,
+  0xcb, 0x43, 0x68, 0x92, 0xd9, 0xca, 0xf3, 0x39, 0xf8, 0x6f, 0x2b, 0x93,
+  // 3
+  0x2e, 0x19, 0x40, 0x53, 0xb4, 0xb4, 0xc2, 0x69, 0x74, 0xce, 0xb6, 0xe2,
+  0x93, 0x3f, 0xfb, 0x61, 0x3c, 0xfa, 0xb4, 0xb8, 0x2c, 0x45, 0xd9, 0xb1,
+  0xf1, 0x93, 0x75, 0xf3, 0x19, 0x7d, 0x13, 0x73, 0xdb, 0x3a, 0x4d, 0x1a,
+  0x69, 0x98, 0xb4, 0x22, 0x59, 0xbe, 0x09, 0x2d, 0x7b, 0x36, 0xaa, 0x20,
+  0xb7, 0x39, 0x69, 0x4c, 0x6c, 0xab, 0x0f, 0x25, 0x34, 0xab, 0xe3, 0x28,
+  0x9e, 0xee, 0x94, 0x6d, 0xe9, 0xcc, 0x87, 0x11, 0xed, 0xa9, 0x71, 0xed,
+  0xa0, 0x08, 0x91, 0xd4, 0xb2, 0x51, 0x0b, 0x0e, 0xf8, 0x02, 0x5c, 0x00,
+  0x23, 0xd5, 0x15, 0xd8, 0x04, 0x29, 0x43, 0xe7, 0x98, 0x8d, 0xc0, 0xcf,
+  0xab, 0x02, 0x2e, 0x88, 0x1a, 0x8c, 0x67, 0xad, 0xcd, 0x3f, 0x56, 0x11,
+  0xdd, 0x7e, 0xf5, 0xd0, 0x6e, 0x03, 0x43, 0xc6, 0x58, 0xce, 0xe9, 0xb0,
+  0x51, 0x9c, 0xd2, 0x82, 0xcd, 0x9f, 0x1b, 0x08, 0x4e, 0x8b, 0x73, 0x7a,
+  0xcc, 0x64, 0x53, 0x68, 0x32, 0xb1, 0xbc, 0x98, 0x40, 0xc4, 0xd1, 0x22,
+  0x76, 0x36, 0xf6, 0x27, 0x0e, 0xb8, 0xf5, 0xaf, 0x8f, 0x1a, 0xab, 0x0c,
+  0xec, 0x92, 0x77, 0x3d, 0x4e, 0x2e, 0x2d, 0xe2, 0x46, 0x3a, 0x21, 0xa9,
+  0x20, 0xc0, 0xe4, 0xd0, 0x5f, 0x9c, 0x46, 0x39, 0x82, 0xa7, 0x74, 0x59,
+  0x84, 0x50, 0xe5, 0x63, 0xe6, 0x5c, 0xfb, 0xfa, 0x26, 0xdd, 0x55, 0xd8,
+  0xa8, 0x54, 0x97, 0x99, 0x93, 0xfa, 0xd8, 0xe1, 0xe5, 0x16, 0xfb, 0x8a,
+  0x25, 0x24, 0xf9, 0xce, 0xfa, 0x2a, 0x50, 0x2b, 0xfc, 0xac, 0x0a, 0x5e,
+  0x4a, 0xc3, 0xb7, 0x1f, 0xb8, 0x42, 0x57, 0xc8, 0x84, 0x92, 0xfd, 0xb2,
+  0x9f, 0x19, 0x9b, 0x0e, 0x36, 0x6a, 0x2a, 0xb4, 0xc4, 0xec, 0x8a, 0x10,
+  0xba, 0xd8, 0x38, 0xf0, 0x38, 0xda, 0x1c, 0x31, 0x6b, 0xa2, 0x06, 0xfa,
+  0x35, 0x3c, 0xca, 0x24, 0x60, 0xa4, 0x66, 0x24, 0x80, 0xee, 0x87, 0x48,
+  0x10, 0x3b, 0xc9, 0x72, 0xb9, 0x9f, 0x4d, 0x9e, 0xcc, 0x7b, 0x76, 0x7f,
+  0x95, 0x0b, 0xde, 0xf8, 0x03, 0x9a, 0xe0, 0xa8, 0xff, 0x52, 0x71, 0x06,
+  0xbb, 0x02, 0xfa, 0xa4, 0x48, 0x19, 0x6c, 0x79, 0x3c, 0xc1, 0x69, 0xf0,
+  0xfb, 0xb4, 0x69, 0xbf, 0x36, 0x72, 0x84, 0xa1, 0x98, 0x59, 0x88, 0x70,
+  0xd2, 0x26, 0xb1, 0xec, 0xf7, 0x42, 0x14, 0x01, 0xeb, 0x8e, 0x30, 0xde,
+  0x1a, 0xd8, 0x01, 0x0c, 0x91, 0x17, 0x83, 0xa6, 0xf6, 0x5f, 0xe4, 0x29,
+  0xc7, 0xd2, 0x21, 0x09, 0x5a, 0x55, 0x7a, 0x65, 0xd0, 0x49, 0x46, 0x5c,
+  0xbf, 0x93, 0x9d, 0x74, 0x9b, 0xfc, 0x63, 0x37, 0x97, 0xe2, 0xc8, 0x99,
+  0xc4, 0xa9, 0xe9, 0x48, 0x2e, 0x00, 0x7c, 0x75, 0x26, 0x03, 0x5c, 0x7b,
+  0x53, 0x65, 0xbf, 0xb2, 0x40, 0xf6, 0xc0, 0x21, 0xda, 0x2b, 0xd9, 0xe3,
+  // 4
+  0xc7, 0x65, 0x52, 0xcb, 0x11, 0x3a, 0xd5, 0x03, 0x64, 0x55, 0x25, 0xc8,
+  0x4f, 0x8d, 0x63, 0x6b, 0xf0, 0x55, 0x26, 0x9d, 0xcc, 0x89, 0x4e, 0x2e,
+  0x20, 0xad, 0x0b, 0xc9, 0x9c, 0x72, 0xfc, 0x8d, 0x93, 0xa7, 0x20, 0xae,
+  0x03, 0x91, 0xb7, 0x57, 0x8c, 0x55, 0x99, 0xc9, 0x7b, 0x46, 0x34, 0xe5,
+  0x6a, 0xb3, 0x04, 0x4f, 0x50, 0x90, 0xe1, 0x9e, 0x49, 0x7c, 0x47, 0x1f,
+  0xf8, 0xcf, 0x71, 0x9d, 0xf2, 0x0c, 0x52, 0x35, 0xae, 0x32, 0x63, 0x47,
+  0xc0, 0xbb, 0xfc, 0x5e, 0xf9, 0x3f, 0x93, 0x72, 0x37, 0x8f, 0xd2, 0xce,
+  0xd4, 0xfe, 0xa0, 0x57, 0xa0, 0x9c, 0xf9, 0x66, 0xaf, 0x1c, 0xdc, 0xe5,
+  0x5c, 0x1b, 0xb1, 0x7f, 0x76, 0x7f, 0xe8, 0xae, 0xf8, 0x21, 0x81, 0x41,
+  0xe6, 0x80, 0xba, 0x22, 0xc8, 0x8d, 0x51, 0xab, 0x45, 0x3c, 0xbc, 0x6a,
+  0x7e, 0x25, 0x71, 0xcd, 0xc1, 0x59, 0x8e, 0x70, 0x5c, 0x7a, 0x69, 0x04,
+  0xe0, 0xcc, 0x10, 0xbc, 0x4e, 0x60, 0xfa, 0xcb, 0xa7, 0x9a, 0x11, 0xd3,
+  0x34, 0xf2, 0xfb, 0xfa, 0xc0, 0x94, 0x83, 0xb4, 0x97, 0xb0, 0x63, 0xcc,
+  0xea, 0xc3, 0x09, 0x4e, 0xa7, 0xfb, 0x76, 0x0f, 0x49, 0x3d, 0x00, 0x18,
+  0x43, 0x2e, 0x25, 0xbb, 0x4b, 0x62, 0x1d, 0xff, 0xb0, 0x7a, 0x04, 0xd6,
+  0xd1, 0x08, 0x0f, 0x52, 0x6c, 0x49, 0x14, 0x64, 0x37, 0xdf, 0x16, 0x09,
+  0xca, 0x56, 0xe5, 0x83, 0xab, 0xdb, 0xe7, 0xee, 0x16, 0xad, 0x07, 0xbf,
+  0x8f, 0x6a, 0x79, 0x57, 0x21, 0xbc, 0xb3, 0xe3, 0x56, 0x78, 0x2d, 0x03,
+  0xc6, 0xa4, 0xe2, 0x6c, 0xcc, 0xb0, 0x81, 0x60, 0x37, 0x2c, 0x9a, 0x29,
+  0x78, 0xc6, 0x81, 0x26, 0x4d, 0x90, 0x08, 0x30, 0xe3, 0x24, 0x72, 0x8b,
+  0xf7, 0xa4, 0x81, 0x44, 0xaa, 0xae, 0xa1, 0x0d, 0xb3, 0xe0, 0x42, 0x2e,
+  0x3d, 0x02, 0x42, 0xbc, 0xae, 0x32, 0x34, 0x28, 0x1a, 0xfe, 0x91, 0xa5,
+  0xd1, 0x69, 0x6e, 0x03, 0xab, 0x87, 0x08, 0x4f, 0x19, 0x08, 0xfe, 0xf9,
+  0xe2, 0xc6, 0x7e, 0x84, 0x89, 0xfc, 0x9d, 0x13, 0x00, 0xe3, 0x10, 0xfc,
+  0xb5, 0x91, 0x0a, 0xd4, 0x89, 0xcd, 0x0f, 0xa3, 0x1e, 0x4c, 0x4f, 0x0d,
+  0x14, 0xcb, 0x17, 0xd1, 0x63, 0xce, 0x66, 0x33, 0x33, 0x83, 0xcf, 0xb9,
+  0x71, 0xa4, 0x0d, 0x6d, 0x14, 0x8b, 0xa1, 0x11, 0xbc, 0xad, 0xb8, 0x1f,
+  0xca, 0xec, 0xd9, 0x2e, 0x3b, 0x9f, 0x37, 0x07, 0x50, 0x20, 0xdb, 0x6f,
+  0xfb, 0xd0, 0xd2, 0x70, 0x20, 0xc8, 0x79, 0x4b, 0x31, 0x23, 0x59, 0x87,
+  0x90, 0x2b, 0xb3, 0xf0, 0x16, 0x68, 0x9b, 0xea, 0x29, 0x6a, 0x47, 0x68,
+  0x6e, 0xe6, 0xf1, 0xe3, 0xdb, 0xd0, 0x57, 0x0a, 0x56, 0x38, 0x3b, 0x9a,
+  0xbe, 0xfe, 0x29, 0xe7, 0x42, 0xcb, 0xdd, 0x3f, 0xc6, 0xbf, 0xf6, 0xd8,
+  // 5
+  0xe4, 0xfa, 0x9d, 0xf7, 0x56, 0x26, 0x29, 0x11, 0x9a, 0x7a, 0x2d, 0x03,
+  0x29, 0x88, 0xaa, 0x7d, 0x63, 0x56, 0x99, 0x72, 0x7c, 0x1a, 0x30, 0x73,
+  0x28, 0x5a, 0x50, 0xd6, 0x6f, 0x07, 0x89, 0x67, 0xdc, 0x20, 0x67, 0x73,
+  0x60, 0x9d, 0xc3, 0x4e, 0xc9, 0xcd, 0xe7, 0x82, 0xbd, 0xc2, 0xf9, 0xe1,
+  0x46, 0xbf, 0xc8, 0x71, 0x2b, 0x25, 0x9e, 0xc5, 0xde, 0xec, 0x44, 0x56,
+  0x04, 0xef, 0xfb, 0x6f, 0xca, 0x99, 0xfa, 0xc4, 0x1f, 0x06, 0xa9, 0x95,
+  0x16, 0x1a, 0xcd, 0x77, 0xb7, 0x22, 0x64, 0xe6, 0x38, 0xea, 0x55, 0x4d,
+  0x36, 0x51, 0x59, 0x74, 0xff, 0x12, 0xc8, 0xdc, 0x8f, 0x7c, 0x28, 0xb1,
+  0x01, 0xe1, 0x33, 0x8b, 0x40, 0xe2, 0xac, 0x79, 0xcc, 0xca, 0x1a, 0x15,
+  0x0b, 0xa2, 0x42, 0xfb, 0x0f, 0x49, 0x65, 0x62, 0x93, 0x82, 0x9c, 0x5b,
+  0x30, 0xb9, 0xc2, 0xda, 0xe2, 0x94, 0x8b, 0x21, 0x03, 0xd5, 0x34, 0x76,
+  0x0e, 0xfa, 0xd8, 0xde, 0x4c, 0xa2, 0x26, 0xff, 0x4e, 0x93, 0xeb, 0x01,
+  0x7e, 0x8e, 0xd4, 0x7a, 0x2c, 0xfb, 0x89, 0xc4, 0xa1, 0x49, 0x18, 0xfe,
+  0x34, 0x3f, 0x36, 0x56, 0x6b, 0x69, 0xd3, 0x36, 0x1c, 0x6d, 0x3d, 0x31,
+  0x1a, 0xc2, 0x1c, 0xbd, 0x98, 0xb4, 0xcd, 0xef, 0x9e, 0x04, 0xd4, 0x17,
+  0xb6, 0xdf, 0xe8, 0x27, 0x85, 0xbc, 0x4b, 0x22, 0x8c, 0xb7, 0x03, 0x7d,
+  0x48, 0xd7, 0x16, 0x0e, 0x13, 0x1f, 0xf5, 0x9b, 0x9f, 0xea, 0x9b, 0xd5,
+  0x08, 0xfd, 0x77, 0x04, 0x87, 0x5f, 0x69, 0x9f, 0x62, 0x73, 0xe8, 0xb5,
+  0x46, 0xb5, 0x08, 0x3c, 0x3f, 0x6a, 0x41, 0x98, 0x67, 0x1f, 0x26, 0x58,
+  0x9c, 0x20, 0x45, 0x10, 0x42, 0x59, 0xb6, 0xaa, 0xa4, 0xc8, 0x2d, 0x8b,
+  0x95, 0xde, 0xdb, 0x47, 0xb5, 0x68, 0xd8, 0xbb, 0x7b, 0xc8, 0x05, 0xc0,
+  0x24, 0x19, 0xdf, 0x14, 0x6d, 0xfb, 0x9f, 0xc4, 0xe9, 0xa2, 0xa9, 0x0e,
+  0x50, 0x1c, 0x97, 0x05, 0x4f, 0x0f, 0x5c, 0x6b, 0xdc, 0x6d, 0xa6, 0xdb,
+  0x56, 0xce, 0x53, 0x1d, 0x97, 0x29, 0xe2, 0xce, 0x0f, 0xc9, 0xa6, 0x98,
+  0x87, 0xf4, 0x2a, 0x80, 0x1f, 0xe5, 0xb2, 0xaa, 0x3b, 0xd7, 0xcc, 0xa0,
+  0x89, 0x87, 0x52, 0x3d, 0x86, 0x5c, 0x88, 0x8d, 0xb1, 0x1a, 0x43, 0x5b,
+  0x64, 0xa4, 0x55, 0x0c, 0xda, 0x1c, 0x0c, 0x2a, 0x26, 0x02, 0x91, 0x45,
+  0x3a, 0x46, 0xfe, 0xba, 0x33, 0xbe, 0x91, 0xdc, 0x4a, 0x32, 0xe9, 0x09,
+  0xb7, 0x70, 0xd6, 0x2a, 0x34, 0xc6, 0x46, 0x32, 0x90, 0x94, 0x25, 0x63,
+  0xa0, 0x4e, 0xaf, 0x0a, 0x55, 0x64, 0x1c, 0xb1, 0x70, 0x62, 0x63, 0x76,
+  0x5e, 0xf0, 0xa5, 0x7c, 0xa8, 0x1a, 0x81, 0x88, 0xcc, 0x90, 0xb6, 0xa3,
+  0xbf, 0x46, 0x59, 0x23, 0x4d, 0xfb, 0x52, 0x3e, 0xe1, 0xbf, 0xd2, 0x3b,
+  // 6
+  0x19, 0x5c, 0x74, 0xfd, 0x17, 0xc0, 0x4d, 0xdb, 0xde, 0xe1, 0xf2, 0xcb,
+  0x1b, 0x9b, 0xae, 0x9c, 0x9d, 0x65, 0x26, 0xcb, 0xb3, 0x51, 0x77, 0x5c,
+  0x7f, 0x9b, 0x11, 0xae, 0x3d, 0x6f, 0xbe, 0x82, 0xb8, 0xb3, 0x8f, 0xde,
+  0xf9, 0xc4, 0x6e, 0x9b, 0xe1, 0x74, 0x20, 0x78, 0xbe, 0x20, 0xe2, 0xa2,
+  0x2a, 0x6c, 0x98, 0x95, 0x07, 0xbb, 0xc1, 0xa6, 0x71, 0xdd, 0xe1, 0x71,
+  0x90, 0x56, 0x6c, 0x32, 0x10, 0x6b, 0xf5, 0x00, 0x17, 0xac, 0x5b, 0x58,
+  0x70, 0xaf, 0x9b, 0x6b, 0xb4, 0x6b, 0x5a, 0x4a, 0xc1, 0x2d, 0x20, 0x8a,
+  0x09, 0xf5, 0x5e, 0x95, 0x5c, 0xb9, 0x5f, 0xab, 0x2a, 0x2b, 0x46, 0xf1,
+  0x0c, 0x82, 0x53, 0x82, 0x19, 0x3e, 0xe9, 0x55, 0x0d, 0x7a, 0x1c, 0x94,
+  0x19, 0x7e, 0xb9, 0x81, 0x10, 0x94, 0x1b, 0x00, 0x99, 0x98, 0xc2, 0x95,
+  0x19, 0xaf, 0x78, 0x4f, 0x6a, 0xbc, 0x12, 0x45, 0x4d, 0x96, 0x9f, 0xfc,
+  0xd1, 0xdc, 0x49, 0xae, 0x7d, 0x96, 0x1d, 0x01, 0xe0, 0xfc, 0x79, 0x7f,
+  0xac, 0x5e, 0xd6, 0x39, 0x67, 0xdc, 0xd4, 0xd8, 0x80, 0xd0, 0xfa, 0x61,
+  0xd8, 0x10, 0x4c, 0x29, 0xa3, 0x3a, 0xf8, 0x16, 0x96, 0xa7, 0xc2, 0x4e,
+  0xe0, 0x9d, 0x78, 0x66, 0xca, 0x4f, 0x06, 0x69, 0x94, 0xcc, 0xc3, 0x0e,
+  0x6c, 0x19, 0xab, 0xdb, 0x11, 0x26, 0xcc, 0x9b, 0xc7, 0x86, 0xae, 0x93,
+  0x9e, 0x30, 0xb6, 0x90, 0x57, 0x55, 0x02, 0x92, 0xf1, 0x66, 0x73, 0x47,
+  0xee, 0xf3, 0x02, 0x2f, 0x38, 0xaa, 0x07, 0xe7, 0xa0, 0xd6, 0x23, 0xff,
+  0x17, 0xa2, 0xfd, 0xd8, 0x39, 0x2e, 0x71, 0x48, 0xcf, 0xa6, 0x41, 0x75,
+  0xf7, 0x71, 0x05, 0x51, 0x5e, 0x0a, 0x7d, 0x88, 0x90, 0x94, 0x41, 0x73,
+  0x38, 0x34, 0xdf, 0x1f, 0x10, 0xa6, 0x54, 0xe0, 0xdf, 0xeb, 0xd6, 0xde,
+  0x76, 0x14, 0x81, 0x61, 0x9e, 0xed, 0x7e, 0x38, 0xcf, 0xd8, 0x35, 0x03,
+  0x47, 0x32, 0x9b, 0x86, 0x89, 0x17, 0x20, 0x57, 0x2b, 0x87, 0xc9, 0x34,
+  0x4b, 0xc6, 0x55, 0xe2, 0xe8, 0x94, 0x07, 0x10, 0x68, 0x8e, 0xd6, 0xe7,
+  0xaa, 0x12, 0x91, 0xa2, 0xaa, 0xfe, 0xe6, 0x0c, 0x18, 0x69, 0x74, 0x1e,
+  0x43, 0x28, 0xf3, 0x3f, 0xae, 0x3a, 0x20, 0x0b, 0xe0, 0x89, 0xa1, 0xb2,
+  0x50, 0x90, 0x31, 0xcb, 0x77, 0xd3, 0x54, 0x56, 0x4e, 0x14, 0xe5, 0x45,
+  0x44, 0x1c, 0x7d, 0xf4, 0xec, 0x78, 0x93, 0x57, 0x5c, 0xda, 0xba, 0xf0,
+  0x9c, 0xa6, 0x82, 0x09, 0xbc, 0x7c, 0x2e, 0xfd, 0x1d, 0x94, 0x91, 0x7f,
+  0xef, 0xac, 0x72, 0x51, 0xe7, 0x7c, 0x6f, 0xe0, 0x59, 0x17, 0xe5, 0x49,
+  0xb3, 0x37, 0x88, 0xd1, 0xe4, 0xe9, 0xfe, 0x43, 0x9e, 0xe8, 0xd2, 0x51,
+  0x7b, 0xf1, 0x7a, 0x3e, 0xa4, 0xd4, 0x90, 0xec, 0x23, 0xed, 0xe6, 0x2d,
+  // 7
+  0x7e, 0xce, 0x48, 0xf1, 0x76, 0xc1, 0x85, 0x4b, 0x5a, 0x69, 0xbd, 0xf7,
+  0x8a, 0x0a, 0x69, 0x0f, 0x12, 0xf9, 0xc1, 0xfa, 0x80, 0x97, 0x54, 0xce,
+  0x7e, 0x07, 0x58, 0x67, 0x33, 0x2e, 0xb8, 0x8d, 0x9b, 0x81, 0xcf, 0x5a,
+  0xe0, 0xd6, 0x29, 0x0b, 0x67, 0x44, 0xa2, 0x5b, 0xb6, 0xa4, 0x6d, 0x2a,
+  0xd4, 0x1e, 0xfa, 0xe9, 0x26, 0xaa, 0xc8, 0x40, 0x39, 0x55, 0x67, 0x37,
+  0xd1, 0xb0, 0x1c, 0xfa, 0x52, 0x1b, 0xc9, 0x00, 0x76, 0x5d, 0xc8, 0xba,
+  0x33, 0x6e, 0x09, 0x1a, 0x86, 0x18, 0xc3, 0x75, 0xc5, 0xe1, 0xa2, 0xb2,
+  0x31, 0xca, 0xd8, 0xea, 0xcf, 0x9e, 0xde, 0x57, 0xd2, 0xd8, 0x62, 0xb5,
+  0x3e, 0x8b, 0xa1, 0x8a, 0x7e, 0x3a, 0x8e, 0xa9, 0x43, 0x62, 0x8e, 0xe4,
+  0x7f, 0x79, 0x9f, 0x85, 0x52, 0xe4, 0x87, 0x02, 0xff, 0xfb, 0xcc, 0xe9,
+  0x80, 0x6d, 0x59, 0x8d, 0x15, 0xac, 0x5b, 0x5a, 0x83, 0xf1, 0x1f, 0xf0,
+  0x19, 0x4d, 0x70, 0x68, 0x73, 0xee, 0x91, 0x09, 0x64, 0xee, 0x5f, 0x7e,
+  0x5d, 0xda, 0x2f, 0x1f, 0x07, 0x50, 0x28, 0x3a, 0x84, 0x14, 0xe3, 0xe9,
+  0x38, 0x51, 0x7c, 0xd0, 0x30, 0x26, 0xd8, 0x70, 0xf1, 0x46, 0xcb, 0x8a,
+  0x63, 0x13, 0x5a, 0x01, 0xf3, 0x8b, 0x20, 0x0f, 0xe7, 0xff, 0xcf, 0x48,
+  0x1c, 0x80, 0x5b, 0x47, 0x55, 0xc1, 0xff, 0x0a, 0xe5, 0xa1, 0x68, 0xe2,
+  0x16, 0xf3, 0x90, 0xd1, 0xb4, 0xa9, 0x0c, 0xde, 0xb7, 0x00, 0x40, 0x67,
+  0xaa, 0xbf, 0x0a, 0xec, 0x1b, 0x52, 0x27, 0x86, 0x24, 0x2e, 0xb3, 0xfb,
+  0x76, 0x2e, 0xf5, 0x39, 0x1d, 0xe8, 0x36, 0x6c, 0x0e, 0x3f, 0x47, 0x4d,
+  0xd5, 0x35, 0x1a, 0x96, 0xd6, 0x34, 0x73, 0xaa, 0xd2, 0xe5, 0x47, 0x40,
+  0x19, 0x08, 0x5b, 0x9b, 0x53, 0x3f, 0xa8, 0x64, 0x5f, 0x9b, 0x32, 0x58,
+  0x4e, 0x66, 0x86, 0xe8, 0x1a, 0xa3, 0x77, 0x1c, 0x0f, 0x39, 0x09, 0x10,
+  0x63, 0xfd, 0x09, 0xa0, 0xad, 0x73, 0xa1, 0xb3, 0xd9, 0xa6, 0xee, 0x05,
+  0x7a, 0xdf, 0xad, 0x6e, 0x8a, 0xe4, 0x23, 0x52, 0x0a, 0xca, 0x32, 0x86,
+  0x52, 0x5c, 0xd8, 0x2d, 0x56, 0xfa, 0x7e, 0x3c, 0x7a, 0x0f, 0x44, 0x97,
+  0x4f, 0xcc, 0xc0, 0x3e, 0x67, 0x22, 0xa0, 0x3b, 0x62, 0xb0, 0x28, 0x7b,
+  0x92, 0xd0, 0xf8, 0xf9, 0x57, 0x20, 0xa5, 0xaf, 0x86, 0x68, 0x7a, 0x5a,
+  0x54, 0x8e, 0x75, 0xc8, 0x9e, 0x5a, 0xe0, 0xb4, 0xd0, 0x45, 0xa6, 0xb3,
+  0x0f, 0x40, 0x8a, 0x30, 0xae, 0x6c, 0xea, 0xf1, 0x93, 0xe6, 0xd7, 0x7f,
+  0xae, 0x5e, 0x3b, 0x99, 0x85, 0x6e, 0x2f, 0x61, 0xbd, 0x77, 0x7a, 0x70,
+  0x80, 0x15, 0xac, 0x19, 0x78, 0x91, 0xf7, 0x52, 0x1a, 0x8c, 0x1b, 0x97,
+  0x6b, 0xb7, 0x63, 0x39, 0x38, 0x26, 0xd4, 0x9c, 0xb3, 0xa5, 0x7e, 0xe1,
+  // 8
+  0xf6, 0x42, 0xec, 0xd8, 0xbb, 0xd5, 0x98, 0x1a, 0x18, 0x71, 0xa5, 0x1e,
+  0x34, 0x1f, 0x8a, 0xa2, 0x1b, 0xb8, 0xd0, 0x48, 0x05, 0x2f, 0x32, 0x2a,
+  0x2b, 0x43, 0xa6, 0x31, 0x86, 0xc4, 0x21, 0x58, 0xfd, 0x2e, 0x0d, 0xed,
+  0xca, 0x74, 0xef, 0xf3, 0xa5, 0xb7, 0x8d, 0xfe, 0xd2, 0xcc, 0xfb, 0x03,
+  0x55, 0xf9, 0xe7, 0x86, 0xe8, 0xec, 0xd3, 0x7c, 0x7d, 0x5d, 0x72, 0xd0,
+  0x99, 0xf6, 0xcb, 0x37, 0x25, 0xc9, 0xfd, 0x52, 0x3e, 0x4e, 0xce, 0xb4,
+  0x42, 0x00, 0xae, 0xc6, 0x27, 0xba, 0xe0, 0x1d, 0xdf, 0x0a, 0xbe, 0xae,
+  0x19, 0x65, 0x57, 0x80, 0x37, 0x9b, 0x55, 0x00, 0x2f, 0x5a, 0x63, 0x49,
+  0x13, 0xcf, 0x3a, 0x3b, 0xa9, 0x1d, 0x0b, 0x46, 0x51, 0x62, 0x26, 0x58,
+  0x8f, 0xaa, 0x40, 0x55, 0x9a, 0xb2, 0xe9, 0x1e, 0x06, 0x46, 0x60, 0x82,
+  0x00, 0x34, 0xd7, 0xbe, 0xaf, 0xee, 0x5e, 0x9f, 0x32, 0x17, 0x11, 0x96,
+  0xa0, 0x19, 0x19, 0x58, 0xc5, 0xf5, 0xaa, 0x2e, 0x8d, 0xee, 0x18, 0xf5,
+  0x10, 0xd2, 0xeb, 0x33, 0xd3, 0x30, 0xb1, 0x78, 0xdd, 0x2b, 0x46, 0x0b,
+  0xc4, 0xdd, 0x25, 0xda, 0xb3, 0x45, 0x5b, 0xbf, 0x6e, 0x01, 0x9b, 0xc9,
+  0x87, 0x8b, 0x26, 0x07, 0xcd, 0x78, 0x10, 0x43, 0x19, 0x35, 0xe4, 0x39,
+  0x4d, 0x19, 0xfd, 0xb2, 0x2d, 0xa8, 0x0c, 0x14, 0xcf, 0x3e, 0x12, 0x19,
+  0xdc, 0xa6, 0x43, 0xb0, 0x53, 0x84, 0xba, 0x14, 0x0a, 0xd1, 0x39, 0x02,
+  0x72, 0xcf, 0xf5, 0xc2, 0xe4, 0x56, 0x19, 0x3d, 0x9f, 0x70, 0xc5, 0x1a,
+  0x91, 0x7d, 0x85, 0xf8, 0x0e, 0x31, 0xdd, 0x3b, 0x45, 0x39, 0x80, 0x19,
+  0x4c, 0x1e, 0x06, 0xcb, 0xeb, 0xc8, 0xff, 0xd6, 0x31, 0xf7, 0xfd, 0x9c,
+  0x06, 0xd1, 0x83, 0x31, 0xb6, 0xe9, 0x95, 0x92, 0xab, 0x3f, 0xc3, 0xc7,
+  0x99, 0x21, 0xf2, 0xf6, 0x3a, 0x75, 0xfd, 0x20, 0x1f, 0x6b, 0xa7, 0xb7,
+  0x54, 0x50, 0x1e, 0x25, 0x22, 0x7b, 0x54, 0xe1, 0xab, 0x18, 0x3a, 0x2a,
+  0x3b, 0x5a, 0x4c, 0xd7, 0xc3, 0xda, 0x81, 0xcb, 0x1a, 0x66, 0x4b, 0xc6,
+  0xb7, 0x23, 0x24, 0x47, 0x4f, 0x67, 0x47, 0xb7, 0x85, 0x9a, 0xc3, 0xed,
+  0x68, 0x27, 0x1f, 0x61, 0x22, 0x5b, 0x7b, 0x98, 0xc7, 0x3b, 0x08, 0x06,
+  0xf7, 0x02, 0xe9, 0x14, 0x1e, 0x8b, 0xa6, 0xa5, 0x9b, 0x5a, 0x51, 0x69,
+  0x70, 0x3b, 0xf9, 0x30, 0xa5, 0xba, 0x21, 0x97, 0xaa, 0x8e, 0xbf, 0xb6,
+  0xca, 0xb5, 0xa0, 0xa8, 0x92, 0xc4, 0x6a, 0xfe, 0x75, 0x2c, 0xc1, 0xe0,
+  0xa4, 0xc4, 0x79, 0x9f, 0x20, 0xa4, 0xc2, 0x00, 0x6a, 0x15, 0xfb, 0x85,
+  0x81, 0xdf, 0xfc, 0xd9, 0xe4, 0xd7, 0xc1, 0x0e, 0x96, 0x25, 0x0f, 0xb6,
+  0x8a, 0x6d, 0xfe, 0x2a, 0x93, 0xcb, 0xd5, 0x85, 0x5d, 0xda, 0x86, 0x17,
+  // 9
+  0xcf, 0x4e, 0xa0, 0x3b, 0xab, 0x2b, 0xf8, 0x83, 0x55, 0xf8, 0xcf, 0x0e,
+  0x7e, 0xfa, 0xac, 0x57, 0x77, 0x82, 0x87, 0x3a, 0x16, 0x7b, 0x87, 0x8e,
+  0x34, 0x49, 0x06, 0xd5, 0x78, 0x35, 0x74, 0xec, 0xe9, 0xb7, 0x4b, 0x0c,
+  0x07, 0xfa, 0x43, 0x38, 0xf7, 0x6d, 0xa4, 0x13, 0xe5, 0x30, 0xd3, 0x98,
+  0xef, 0x8d, 0x1e, 0xd3, 0x57, 0xb7, 0x15, 0x01, 0xb2, 0x27, 0x14, 0x5b,
+  0x38, 0x55, 0xa7, 0x36, 0x7d, 0x6d, 0x1c, 0xe5, 0x82, 0x43, 0x00, 0x6d,
+  0xb7, 0xec, 0x94, 0x05, 0x3d, 0x2c, 0x65, 0x79, 0x8a, 0x04, 0xad, 0xbf,
+  0xe6, 0x1a, 0xff, 0xd4, 0xe6, 0x0b, 0x36, 0x25, 0x1c, 0xa9, 0x10, 0xb5,
+  0xaa, 0x2a, 0x73, 0x3c, 0xe3, 0x6a, 0xb9, 0xc8, 0xdc, 0x6e, 0x2f, 0x74,
+  0xdd, 0x26, 0xc2, 0x12, 0xe0, 0xdc, 0xf4, 0x4e, 0x6b, 0xce, 0x75, 0x92,
+  0xf9, 0x06, 0x43, 0xd6, 0xea, 0x18, 0xdd, 0x05, 0x97, 0x0a, 0x37, 0x18,
+  0xaf, 0x26, 0x30, 0x52, 0x39, 0x73, 0x54, 0x44, 0xd1, 0x13, 0x3f, 0x4b,
+  0x46, 0x89, 0x23, 0x73, 0xad, 0x64, 0xc1, 0x03, 0xe0, 0x4c, 0x90, 0xe2,
+  0x56, 0x3c, 0x72, 0x57, 0x05, 0x06, 0x26, 0x9f, 0x63, 0xad, 0xb1, 0x3a,
+  0x09, 0x86, 0xe8, 0xed, 0xd8, 0x65, 0xf1, 0x3b, 0xb8, 0x3b, 0xc4, 0xfb,
+  0x59, 0x21, 0x6e, 0x8a, 0x1a, 0x06, 0xc3, 0x4f, 0x53, 0x5b, 0x21, 0x91,
+  0xc0, 0xc5, 0x75, 0xc1, 0x41, 0x5d, 0x8a, 0x55, 0xc9, 0x78, 0x0e, 0x80,
+  0x8d, 0xf1, 0x42, 0x8f, 0x9e, 0x99, 0x06, 0x72, 0x60, 0x02, 0x8e, 0x5d,
+  0x5e, 0xc4, 0x6d, 0xfd, 0xf1, 0x98, 0xf5, 0xc7, 0x73, 0xca, 0x5a, 0x8a,
+  0xd2, 0x40, 0x76, 0x67, 0x43, 0xa4, 0x66, 0xcc, 0x95, 0xef, 0xdf, 0xcb,
+  0xcc, 0x4d, 0x56, 0x8e, 0x67, 0xe4, 0xdb, 0x26, 0xa3, 0x72, 0x76, 0xb1,
+  0xec, 0x67, 0xd6, 0x00, 0x82, 0xf9, 0x6a, 0xf1, 0x20, 0xa7, 0x5d, 0x00,
+  0xf1, 0xa2, 0x82, 0xa8, 0x48, 0xf8, 0xec, 0x3e, 0x2b, 0xcf, 0x5d, 0x75,
+  0xb4, 0xab, 0x4e, 0x40, 0x04, 0xe8, 0x4a, 0xe0, 0xe8, 0x77, 0xe7, 0xc2,
+  0xe3, 0xd8, 0xfb, 0x31, 0x20, 0xdf, 0x97, 0x39, 0x21, 0xd3, 0x80, 0x21,
+  0xe0, 0x2e, 0x16, 0x6e, 0x70, 0x3a, 0x21, 0x63, 0x78, 0xdb, 0x6e, 0x73,
+  0x0e, 0x4e, 0xa5, 0x49, 0x32, 0x92, 0x1f, 0xa8, 0xa6, 0xeb, 0x8d, 0x42,
+  0x36, 0x0a, 0x34, 0x61, 0xf4, 0x25, 0xfb, 0x95, 0xf6, 0xdd, 0x3e, 0x5f,
+  0x06, 0x07, 0xc5, 0xec, 0xf4, 0x50, 0xa1, 0x46, 0x6d, 0xb9, 0xa6, 0x60,
+  0x4c, 0x71, 0x44, 0x93, 0x7f, 0xae, 0x8b, 0x80, 0x3e, 0xd7, 0x3c, 0xd6,
+  0x79, 0xf2, 0x80, 0x4d, 0xf4, 0x42, 0x83, 0x0f, 0xc0, 0xae, 0x0a, 0x0e,
+  0x0f, 0x3a, 0xab, 0xa8, 0xe2, 0xfb, 0x2b, 0x9a, 0xd5, 0x44, 0x9e, 0x77,
+  // 10
+  0x5d, 0x18, 0x4f, 0x6a, 0x39, 0xad, 0x45, 0xfe, 0x18, 0x5f, 0x2a, 0x75,
+  0x28, 0x32, 0xf5, 0xf9, 0xd5, 0xf6, 0x40, 0x57, 0xbe, 0x55, 0x3d, 0x94,
+  0xbf, 0xb7, 0xe3, 0x90, 0xdd, 0xfd, 0xe3, 0x0a, 0x8b, 0x7c, 0x9f, 0x4f,
+  0x16, 0xff, 0x2c, 0x15, 0xb0, 0xdb, 0x6d, 0x90, 0xe5, 0xde, 0x10, 0x21,
+  0x33, 0xd9, 0x83, 0x58, 0x09, 0x9c, 0x14, 0x0b, 0x52, 0xb7, 0x70, 0xb1,
+  0x8a, 0xb5, 0x98, 0x9e, 0x77, 0xae, 0x75, 0x7b, 0xc3, 0xdf, 0x8f, 0x9d,
+  0x54, 0x6e, 0xe3, 0x0f, 0xef, 0x2a, 0x9e, 0x4c, 0xd2, 0x20, 0x02, 0x43,
+  0x62, 0x3a, 0xa3, 0x44, 0xcb, 0xf4, 0xe3, 0x01, 0x83, 0xdc, 0x44, 0xcc,
+  0x62, 0xb8, 0x7b, 0xc6, 0x92, 0xef, 0xae, 0x96, 0xc4, 0xc8, 0x46, 0xed,
+  0x59, 0x89, 0x8c, 0x98, 0xad, 0x3a, 0x20, 0xd1, 0xb2, 0xaa, 0x07, 0x58,
+  0x90, 0x79, 0xc4, 0x2d, 0x9e, 0xea, 0x17, 0xe4, 0x2b, 0xb6, 0x39, 0x80,
+  0xab, 0x25, 0xe1, 0x7c, 0x76, 0x94, 0xbf, 0xca, 0xb5, 0xa4, 0xe1, 0x96,
+  0x4e, 0xb1, 0x77, 0x2b, 0xcb, 0xa0, 0x23, 0xdd, 0x29, 0xb7, 0x02, 0x8f,
+  0x75, 0x97, 0x8e, 0x8c, 0x5f, 0xdc, 0x37, 0x4f, 0x6c, 0x98, 0x5a, 0xc4,
+  0x0f, 0xfb, 0x97, 0x57, 0xc6, 0x64, 0xce, 0x15, 0x72, 0x28, 0xc5, 0x95,
+  0x81, 0xb1, 0xf9, 0x09, 0x8d, 0xd5, 0x47, 0x81, 0x8b, 0xa3, 0x15, 0xd3,
+  0x40, 0xfa, 0xe5, 0xe5, 0x30, 0x6b, 0xd1, 0xc1, 0xef, 0xbf, 0x4c, 0xff,
+  0x3c, 0x18, 0x7f, 0x08, 0x92, 0xff, 0x7b, 0x73, 0x33, 0xaf, 0x25, 0xb2,
+  0xdc, 0x9b, 0x68, 0xc1, 0x71, 0x53, 0xff, 0xda, 0x3a, 0x82, 0x0f, 0x17,
+  0xd6, 0x5e, 0x17, 0x7f, 0x6a, 0xfa, 0x68, 0x9a, 0xd0, 0xcf, 0x60, 0x2d,
+  0x29, 0x2b, 0x14, 0x75, 0xac, 0x93, 0x57, 0xe0, 0xac, 0x3d, 0x7b, 0x4b,
+  0x8e, 0x8c, 0x2b, 0x85, 0xd6, 0x96, 0xac, 0x49, 0x15, 0x6c, 0xfd, 0x3d,
+  0x9d, 0x1c, 0xf0, 0xcc, 0xcf, 0xaa, 0x12, 0xde, 0x74, 0x13, 0x52, 0xb5,
+  0xcb, 0x0a, 0x11, 0xfc, 0x16, 0xb7, 0x19, 0x20, 0xd1, 0x0e, 0x51, 0x5a,
+  0xb3, 0xa8, 0xeb, 0xe5, 0x62, 0x43, 0x08, 0xb1, 0xf8, 0xe5, 0x50, 0xde,
+  0xf2, 0x33, 0x75, 0xcb, 0x24, 0x76, 0x25, 0xa4, 0x48, 0x6e, 0xe0, 0x62,
+  0x79, 0xd5, 0x1a, 0xdb, 0x85, 0x19, 0xab, 0xe8, 0x39, 0x17, 0xb4, 0x0f,
+  0x8b, 0xf2, 0x54, 0x59, 0x0a, 0x9c, 0x24, 0x02, 0x05, 0x32, 0x7c, 0x19,
+  0x2a, 0x64, 0x2e, 0x49, 0xe6, 0x95, 0x95, 0x6c, 0xb1, 0x3a, 0x02, 0xe9,
+  0x74, 0x83, 0x71, 0x31, 0xfc, 0xc1, 0x60, 0xb8, 0x94, 0xf6, 0x71, 0xf0,
+  0x4b, 0xca, 0xaa, 0x56, 0xd0, 0x7e, 0x42, 0x44, 0x06, 0x1d, 0xaa, 0x80,
+  0xbd, 0x04, 0x25, 0x37, 0xe8, 0x7b, 0xcc, 0x30, 0xe1, 0xde, 0x6f, 0xd3,
+  // 11
+  0xd1, 0x79, 0x8d, 0x13, 0x20, 0x62, 0x5d, 0xf6, 0xb0, 0xcb, 0xf9, 0xa7,
+  0xa7, 0x96, 0x0b, 0xac, 0x69, 0x08, 0xdf, 0x2b, 0x36, 0xce, 0x17, 0x16,
+  0x95, 0x95, 0x23, 0xcb, 0xcb, 0x8d, 0xa2, 0xc0, 0xb7, 0x63, 0x5d, 0xe5,
+  0x37, 0xe8, 0x41, 0x4a, 0x22, 0xff, 0x1b, 0x5a, 0xef, 0x22, 0x4b, 0xc8,
+  0x13, 0xaa, 0x77, 0x04, 0x62, 0xd2, 0x21, 0x1d, 0x6d, 0x6a, 0x29, 0x09,
+  0xc3, 0x2c, 0xe6, 0xe1, 0x06, 0x87, 0x15, 0xfd, 0x66, 0x0c, 0x0b, 0xcc,
+  0xc1, 0xa4, 0xb9, 0xd9, 0x49, 0x76, 0x98, 0xb9, 0x26, 0x53, 0xc8, 0x67,
+  0x44, 0xed, 0x42, 0xec, 0xef, 0xc9, 0x12, 0x50, 0x9f, 0x46, 0xa0, 0x0f,
+  0xff, 0x61, 0xfe, 0xe5, 0x84, 0x24, 0xc9, 0x4c, 0x29, 0x4a, 0x3e, 0x91,
+  0x43, 0x64, 0x9f, 0x15, 0x18, 0xfa, 0x3d, 0xc6, 0x90, 0x6d, 0xc9, 0x7d,
+  0x10, 0x60, 0x58, 0x2b, 0x79, 0x2e, 0xb8, 0x6f, 0x41, 0xb4, 0xd7, 0x4d,
+  0x3b, 0x67, 0x93, 0xd3, 0xe7, 0xd1, 0x7f, 0x4c, 0x8f, 0x13, 0x98, 0x90,
+  0x06, 0x11, 0xf6, 0xb7, 0x1d, 0x7d, 0x05, 0xbb, 0xb4, 0x30, 0x19, 0x77,
+  0x2b, 0x70, 0x76, 0x02, 0x40, 0x77, 0xeb, 0x85, 0xae, 0x63, 0x2f, 0x66,
+  0xe8, 0xdd, 0xbf, 0x68, 0x95, 0x3b, 0x6e, 0x66, 0x49, 0x57, 0x6f, 0xe2,
+  0xbe, 0x61, 0xbb, 0xb3, 0x92, 0x9a, 0x07, 0x41, 0x8b, 0xf8, 0x9e, 0xe4,
+  0x61, 0x48, 0x06, 0x4d, 0xda, 0x0c, 0x92, 0xc6, 0x13, 0x94, 0xfd, 0x59,
+  0x40, 0x72, 0xd8, 0x9b, 0x29, 0x38, 0x0b, 0x4f, 0x93, 0x1f, 0x69, 0xb4,
+  0x70, 0xdd, 0x3f, 0xd0, 0xa1, 0x4b, 0xe8, 0x2a, 0xea, 0xf5, 0x01, 0xfa,
+  0x45, 0x41, 0x0a, 0x98, 0x01, 0x11, 0xe4, 0xed, 0x7b, 0x12, 0xdb, 0xd1,
+  0xb8, 0x64, 0xd7, 0xf1, 0xd4, 0x35, 0xf3, 0x35, 0xb0, 0x00, 0x51, 0x6c,
+  0xc4, 0x6c, 0x5f, 0x69, 0x88, 0x9c, 0x3b, 0xc1, 0x8c, 0x04, 0x37, 0xcf,
+  0x24, 0x95, 0x2e, 0xfb, 0xb5, 0x76, 0x6f, 0x4d, 0xb9, 0x76, 0x2c, 0x35,
+  0x9a, 0x2c, 0x4d, 0x6e, 0xbd, 0xfc, 0x6e, 0x1e, 0x6e, 0x65, 0xb1, 0xfd,
+  0xd6, 0x56, 0xec, 0xee, 0x10, 0x45, 0xf7, 0xa2, 0xbd, 0xed, 0xff, 0x7a,
+  0x70, 0xdb, 0xeb, 0x59, 0xe7, 0x6a, 0xea, 0x0f, 0x4f, 0x57, 0x73, 0x80,
+  0x6f, 0xf9, 0x8c, 0x42, 0xbf, 0xf6, 0x53, 0x24, 0x45, 0x00, 0x81, 0xda,
+  0x7c, 0xf3, 0x3b, 0x58, 0xe2, 0xed, 0x88, 0xf2, 0x02, 0x81, 0x4c, 0x71,
+  0x18, 0x13, 0xd0, 0x1a, 0x06, 0x8a, 0x8d, 0xb2, 0xff, 0x18, 0x85, 0xce,
+  0x8b, 0xb7, 0xef, 0x17, 0xe6, 0xe4, 0x93, 0xfa, 0x73, 0xea, 0x8e, 0x80,
+  0x37, 0x19, 0xf7, 0xb5, 0x31, 0x7a, 0x3a, 0xc5, 0xd3, 0x11, 0x83, 0x63,
+  0x07, 0xd9, 0xe7, 0x4c, 0x8a, 0x6a, 0xfc, 0xf4, 0x69, 0x58, 0x2f, 0x20,
+  // 12
+  0xac, 0xc0, 0x01, 0x35, 0x47, 0x16, 0x8a, 0xe2, 0x60, 0xe8, 0x38, 0x2a,
+  0xcc, 0xd4, 0x9d, 0xe1, 0x22, 0xdf, 0xe7, 0x2f, 0xc7, 0x9f, 0x6e, 0x2a,
+  0x63, 0x77, 0xb3, 0x1a, 0x86, 0xea, 0x8d, 0x09, 0xd6, 0x8e, 0xa9, 0xb1,
+  0x59, 0xaf, 0xf0, 0x31, 0xb4, 0xb4, 0x11, 0x72, 0xa9, 0xf5, 0xa9, 0xe6,
+  0x0e, 0x74, 0x3a, 0x07, 0x81, 0x92, 0xfa, 0x5a, 0xcf, 0xf6, 0xfc, 0xcb,
+  0xef, 0x99, 0xdd, 0x57, 0x7f, 0x9b, 0xb4, 0xfd, 0xbb, 0x08, 0x4e, 0xa3,
+  0xd6, 0x1b, 0x49, 0xa2, 0x9a, 0x4a, 0x80, 0xdc, 0x91, 0x7d, 0xf2, 0x81,
+  0x08, 0xe6, 0x16, 0x91, 0x4e, 0x4c, 0x8c, 0x19, 0x8d, 0x9a, 0xa8, 0x92,
+  0x2b, 0x29, 0x2b, 0x70, 0xfe, 0xb1, 0x72, 0x95, 0xf4, 0xbb, 0xb8, 0x84,
+  0x1f, 0xe2, 0xee, 0x95, 0x30, 0xd6, 0xf9, 0xc3, 0x59, 0xaa, 0x0a, 0x69,
+  0xad, 0x0a, 0x7a, 0xba, 0xbc, 0x91, 0xdc, 0x5a, 0x0a, 0xf9, 0x75, 0x97,
+  0xf6, 0xc1, 0x59, 0x86, 0xc8, 0x71, 0x37, 0x81, 0x6e, 0x79, 0xe5, 0xb0,
+  0xeb, 0x59, 0x9e, 0x10, 0x2f, 0x01, 0xc1, 0x41, 0x3f, 0x2b, 0xfc, 0x93,
+  0xb6, 0x67, 0xc2, 0xaf, 0x90, 0x73, 0xe7, 0x3c, 0xc6, 0x9a, 0xf6, 0xf4,
+  0x3c, 0x2e, 0x36, 0x0b, 0x49, 0x1e, 0x8f, 0x1a, 0x7c, 0xab, 0x0a, 0xba,
+  0xfe, 0xd9, 0x1e, 0xb5, 0x1b, 0x49, 0xc6, 0x86, 0x18, 0x1c, 0xc9, 0x7a,
+  0xd2, 0x6d, 0x4f, 0x9b, 0xac, 0x2c, 0x27, 0x00, 0xc7, 0xad, 0x35, 0xd1,
+  0xb4, 0x9f, 0x73, 0x41, 0x14, 0x6e, 0xdc, 0x80, 0x73, 0x0e, 0x2d, 0xe1,
+  0xb4, 0xd4, 0x57, 0xc4, 0xec, 0x3e, 0xed, 0x17, 0x37, 0x60, 0x23, 0xa0,
+  0xb6, 0x10, 0x56, 0xa6, 0xc1, 0x7c, 0xcd, 0x25, 0xc1, 0x2b, 0xbd, 0xd1,
+  0x17, 0xa0, 0x4e, 0xec, 0xda, 0xc5, 0xbf, 0x9f, 0xe1, 0xd0, 0x31, 0x4f,
+  0x8c, 0x62, 0xd1, 0x3b, 0xd9, 0xec, 0x95, 0x04, 0xe5, 0x00, 0xa4, 0xac,
+  0xe9, 0x74, 0xa3, 0x5c, 0xc9, 0x3f, 0x8c, 0xcd, 0xcc, 0x84, 0x9d, 0xd7,
+  0xc2, 0x7c, 0x6c, 0x92, 0xfa, 0xc3, 0x5d, 0xe2, 0xfd, 0x36, 0x6b, 0xf5,
+  0xe7, 0xa0, 0x91, 0x12, 0x9f, 0x40, 0xaf, 0x08, 0xf7, 0x60, 0xaf, 0xbf,
+  0x66, 0xef, 0xe3, 0xf7, 0x65, 0x90, 0xac, 0xee, 0x6d, 0x41, 0xf8, 0x91,
+  0xde, 0x9f, 0x5f, 0xf3, 0xba, 0x40, 0x10, 0xe2, 0x36, 0xdd, 0x8a, 0xcf,
+  0xfc, 0xd8, 0xa2, 0x0d, 0x2d, 0xd5, 0x28, 0x59, 0xca, 0x0d, 0x14, 0x88,
+  0x81, 0xed, 0xa2, 0xc3, 0x90, 0x04, 0x5c, 0x04, 0x9e, 0x8a, 0xd8, 0x00,
+  0x61, 0x87, 0x3d, 0x7e, 0x13, 0x3b, 0xde, 0xeb, 0x4c, 0x5a, 0x17, 0xab,
+  0xbe, 0x7b, 0xfb, 0x8f, 0xbd, 0x0c, 0xa0, 0x09, 0xc4, 0x6a, 0xce, 0x14,
+  0x0a, 0x18, 0x0f, 0xc2, 0x29, 0x7b, 0x88, 0x72, 0xbe, 0xa8, 0x2d, 0xf7,
+  // 13
+  0x5f, 0xc0, 0x06, 0x0a, 0x63, 0x70, 0xb6, 0x6c, 0x89, 0x59, 0x88, 0xef,
+  0x9b, 0xec, 0xce, 0xc7, 0x60, 0x0c, 0x5c, 0x4c, 0x63, 0x88, 0xd0, 0x60,
+  0x76, 0x4f, 0x95, 0x6b, 0x03, 0x5d, 0x5b, 0xd5, 0x2a, 0xa6, 0x14, 0x84,
+  0x0f, 0x34, 0xdf, 0x91, 0x93, 0xa6, 0x3d, 0xd0, 0xa7, 0x30, 0x42, 0xe4,
+  0x79, 0x85, 0xd5, 0x0a, 0x20, 0x30, 0x1a, 0x74, 0x7f, 0x51, 0xd0, 0xb1,
+  0xd6, 0xe4, 0x16, 0x0f, 0x8e, 0x66, 0xe8, 0xac, 0x5f, 0x34, 0x42, 0x61,
+  0x80, 0xf7, 0x4f, 0xc9, 0xdc, 0x59, 0x07, 0xf9, 0xfa, 0x90, 0xf3, 0xc8,
+  0x39, 0xd6, 0xa8, 0x95, 0x63, 0x80, 0xa6, 0x5a, 0xe7, 0xf1, 0x23, 0x11,
+  0x0d, 0x24, 0x95, 0x42, 0xe9, 0xda, 0x5d, 0xfc, 0xbb, 0xcd, 0x2e, 0x60,
+  0x2a, 0x8d, 0x49, 0x37, 0x18, 0xb9, 0xad, 0xda, 0xf9, 0xa5, 0x22, 0x57,
+  0x1b, 0x32, 0xef, 0x7b, 0xca, 0xae, 0x10, 0xb1, 0x6c, 0x50, 0x73, 0x55,
+  0x7c, 0xc5, 0x44, 0xd2, 0xae, 0xf3, 0x56, 0x8c, 0x30, 0xf3, 0x0e, 0x56,
+  0x0e, 0x8f, 0xfe, 0xe5, 0x55, 0x1d, 0xbd, 0x83, 0xe6, 0xb3, 0x14, 0xe0,
+  0x2e, 0x76, 0xd5, 0x3a, 0xf5, 0xc4, 0x09, 0x19, 0x8f, 0x43, 0x0f, 0x7c,
+  0xf7, 0xc2, 0x6e, 0x4d, 0x8d, 0x63, 0x03, 0x75, 0x9a, 0xf9, 0xf1, 0x8c,
+  0x9b, 0xf5, 0x35, 0x14, 0xf0, 0xbf, 0xc5, 0xcb, 0xed, 0xeb, 0x84, 0xb2,
+  0x71, 0x47, 0x28, 0x86, 0x14, 0xb1, 0x30, 0xf9, 0x14, 0xeb, 0x82, 0x2f,
+  0xc3, 0x06, 0x58, 0x96, 0x44, 0xda, 0x34, 0xb0, 0xf1, 0x61, 0xed, 0x0a,
+  0xed, 0xa2, 0x52, 0xf4, 0xdd, 0x32, 0x5c, 0x2b, 0x68, 0x20, 0xd5, 0xac,
+  0xce, 0x91, 0x70, 0x92, 0x85, 0xf9, 0x8f, 0x72, 0xfa, 0xec, 0xa5, 0xe5,
+  0x35, 0xc9, 0xdf, 0x90, 0xa5, 0xdc, 0x71, 0x96, 0x61, 0x77, 0xb1, 0x66,
+  0xb0, 0xfc, 0xa7, 0x90, 0x48, 0x9f, 0x84, 0x14, 0xdb, 0xad, 0x08, 0x31,
+  0xc8, 0x54, 0xa1, 0xc2, 0xe3, 0xa9, 0xf2, 0xe5, 0x5d, 0xd7, 0xc1, 0x30,
+  0xb5, 0x5b, 0xf9, 0x65, 0xcb, 0x0b, 0xa6, 0xdd, 0xfd, 0x6a, 0x6d, 0x76,
+  0x82, 0x41, 0xc9, 0xb6, 0x8b, 0x27, 0xcf, 0xa7, 0x79, 0x3d, 0xb0, 0x1c,
+  0x24, 0x3f, 0x4e, 0xfb, 0x8f, 0x27, 0xea, 0x35, 0xd1, 0xd1, 0x0f, 0x95,
+  0x85, 0x8c, 0xf1, 0xae, 0x16, 0xa2, 0x3b, 0x3c, 0x88, 0xf1, 0xae, 0xb6,
+  0x33, 0xe1, 0xeb, 0x14, 0xee, 0xcc, 0x48, 0x78, 0xab, 0xd0, 0x06, 0x84,
+  0x56, 0x00, 0xe7, 0xcb, 0x60, 0xf1, 0xb3, 0xd1, 0xb3, 0x99, 0x9d, 0xbf,
+  0xb7, 0x18, 0x5e, 0xd0, 0x45, 0x84, 0x6b, 0xb7, 0x1f, 0x11, 0x74, 0xc6,
+  0xec, 0xd9, 0xd5, 0xd8, 0x0e, 0x47, 0xee, 0x85, 0xf3, 0x8d, 0x93, 0x02,
+  0x36, 0xc7, 0xd6, 0x69, 0xcf, 0x69, 0xaa, 0x3d, 0xb9, 0x48, 0xe5, 0xd6,
+  // 14
+  0x24, 0x30, 0x63, 0x33, 0x3f, 0xc8, 0x4d, 0x6c, 0x1d, 0x1d, 0xf3, 0x9d,
+  0x29, 0xc7, 0x47, 0x5d, 0x8e, 0x46, 0xa5, 0xb4, 0x50, 0x8d, 0x22, 0xe6,
+  0xf1, 0xec, 0x79, 0x4d, 0x0b, 0x54, 0xb6, 0xf0, 0xa7, 0x3e, 0xe3, 0xc9,
+  0x71, 0x7a, 0xd6, 0x83, 0xcd, 0x3c, 0x91, 0x39, 0x57, 0xd3, 0x3d, 0xf1,
+  0x17, 0x38, 0x4f, 0xcd, 0x32, 0x72, 0x31, 0x82, 0x63, 0xa3, 0x36, 0x33,
+  0x49, 0x31, 0x26, 0xd3, 0x8e, 0x7c, 0x2b, 0xea, 0x50, 0xbb, 0x2f, 0x5c,
+  0xe2, 0xbc, 0x4f, 0xb4, 0x6d, 0xb5, 0xb9, 0x09, 0xdb, 0x56, 0x01, 0xb7,
+  0xb3, 0x2a, 0x11, 0x7d, 0xd2, 0x6b, 0x38, 0xea, 0xf0, 0xf7, 0xab, 0xcd,
+  0x03, 0xcf, 0xde, 0x19, 0x11, 0x4a, 0xd8, 0x72, 0x36, 0x54, 0x00, 0x31,
+  0x18, 0xcb, 0xac, 0xac, 0x18, 0x66, 0x99, 0x31, 0x94, 0x26, 0x22, 0xad,
+  0x81, 0xc7, 0xa3, 0xf1, 0xf7, 0x7f, 0xb7, 0x80, 0x65, 0x32, 0x17, 0x70,
+  0x40, 0xad, 0x39, 0x53, 0x1a, 0x77, 0x76, 0xbc, 0xe5, 0x74, 0x9c, 0x89,
+  0x12, 0xdb, 0xd6, 0xdc, 0x33, 0x2b, 0x5c, 0xc7, 0x4a, 0xed, 0x64, 0x1f,
+  0x51, 0xce, 0x1d, 0x95, 0x35, 0x47, 0x63, 0x33, 0x06, 0xe5, 0xa2, 0xf6,
+  0xb9, 0x4e, 0x44, 0x15, 0xe0, 0x2e, 0x21, 0xa0, 0x69, 0x97, 0x76, 0x4d,
+  0x1c, 0xd5, 0x40, 0x3f, 0xdd, 0xa8, 0xf2, 0xb0, 0xb6, 0x62, 0x38, 0x29,
+  0x3e, 0xae, 0xca, 0x14, 0x50, 0x3f, 0xb3, 0x1b, 0x1c, 0x30, 0xa2, 0xd8,
+  0x58, 0x88, 0xff, 0x35, 0x9b, 0x37, 0xc2, 0x06, 0xe4, 0xd3, 0xb6, 0xdc,
+  0xae, 0xf7, 0x30, 0xa8, 0xa0, 0xc2, 0x2e, 0x94, 0x5f, 0xda, 0x85, 0xac,
+  0xf5, 0x45, 0x07, 0xb3, 0x56, 0xbe, 0x1c, 0xaa, 0xd4, 0xf8, 0x99, 0x5f,
+  0x5d, 0xbf, 0xd9, 0x5d, 0x0d, 0xe6, 0x6c, 0x5b, 0x2c, 0xc3, 0x07, 0x9a,
+  0xa3, 0x9a, 0xf9, 0x62, 0xdb, 0x0c, 0x5b, 0x39, 0x3c, 0x07, 0x13, 0x40,
+  0x9b, 0x40, 0x1e, 0x0b, 0x84, 0x9c, 0xc7, 0x2c, 0x7e, 0xd8, 0x10, 0x19,
+  0x87, 0xc7, 0x9e, 0x1f, 0x67, 0x67, 0x2e, 0x72, 0x0f, 0x9f, 0x42, 0xfd,
+  0xf0, 0x86, 0x8b, 0x79, 0xf7, 0x29, 0x9c, 0x47, 0x40, 0x6c, 0x22, 0x81,
+  0x5a, 0xd3, 0xc4, 0x0e, 0xf9, 0x75, 0x68, 0xa3, 0x51, 0xd4, 0x1d, 0x4d,
+  0x19, 0x8d, 0xc3, 0xe8, 0x1d, 0xf2, 0x0f, 0x1c, 0x41, 0x67, 0xca, 0xec,
+  0x2f, 0x40, 0x15, 0x5e, 0x84, 0x3d, 0x04, 0xe6, 0x71, 0xad, 0x08, 0x96,
+  0x89, 0x18, 0x15, 0x6d, 0xde, 0xf1, 0x6b, 0x05, 0xac, 0x4b, 0x0a, 0x1e,
+  0xe8, 0x8d, 0xd5, 0xb1, 0xee, 0xf5, 0x16, 0xe6, 0xdf, 0x9c, 0xb9, 0xdd,
+  0xd3, 0x75, 0x2b, 0xd1, 0xed, 0x7a, 0xb6, 0xfc, 0x02, 0x53, 0xff, 0x3f,
+  0xce, 0x7e, 0xf7, 0x50, 0x26, 0xef, 0x76, 0x45, 0x13, 0x4e, 0x2f, 0x3b,
+  // 15
+  0xb4, 0xf1, 0xf0, 0x00, 0x3e, 0xe9, 0x83, 0x1c, 0x91, 0x95, 0xc2, 0x11,
+  0xd0, 0xe4, 0x64, 0xd3, 0xc7, 0x61, 0x3c, 0x85, 0x92, 0xc1, 0xae, 0x82,
+  0xb9, 0x9e, 0x5e, 0x81, 0x38, 0xa7, 0x92, 0xb3, 0x44, 0x3a, 0x72, 0xef,
+  0x37, 0x66, 0x30, 0x93, 0x02, 0x2e, 0xd6, 0x1e, 0xb7, 0x20, 0x35, 0xb5,
+  0x74, 0x19, 0x8f, 0x01, 0xfc, 0x3a, 0xf7, 0x8b, 0xf2, 0x30, 0x0f, 0x00,
+  0x6d, 0xf5, 0xc2, 0x21, 0xc8, 0x6c, 0xdb, 0x93, 0x93, 0xa7, 0xec, 0xd0,
+  0x6d, 0xad, 0x8e, 0x86, 0x24, 0x8c, 0x9d, 0x31, 0x48, 0xae, 0x08, 0x96,
+  0x7f, 0xd2, 0x57, 0x75, 0x1c, 0x18, 0x1c, 0x96, 0xb4, 0xd6, 0x5b, 0x01,
+  0x13, 0x0f, 0x56, 0x7d, 0x56, 0x76, 0x3a, 0x3b, 0x0f, 0xa4, 0x00, 0xf5,
+  0x7b, 0xfa, 0x5f, 0x5c, 0x7a, 0x00, 0xfd, 0xf7, 0xe4, 0xbe, 0xad, 0x63,
+  0x88, 0xe6, 0x33, 0xb9, 0xd5, 0x7e, 0x95, 0x81, 0xf9, 0xfa, 0x75, 0x31,
+  0x43, 0x62, 0x1e, 0x9f, 0x84, 0x55, 0x51, 0xb0, 0x7b, 0x47, 0x0e, 0xad,
+  0x5e, 0x4b, 0x32, 0x4c, 0xff, 0xd8, 0xcf, 0xe4, 0x76, 0xa2, 0xf4, 0x9c,
+  0x99, 0x06, 0x93, 0xea, 0x0a, 0x64, 0xef, 0xff, 0x22, 0x7c, 0x2e, 0xd1,
+  0x9e, 0x87, 0x54, 0x6d, 0x60, 0xe6, 0xa8, 0x22, 0x0f, 0xf5, 0x4f, 0x81,
+  0x90, 0x2a, 0x41, 0x3f, 0x54, 0x4c, 0xbd, 0x73, 0x8f, 0xeb, 0x18, 0xce,
+  0x39, 0x69, 0xf2, 0x65, 0x91, 0x3e, 0x7f, 0x87, 0x8c, 0xf3, 0x2e, 0x39,
+  0xba, 0xac, 0xfc, 0x0c, 0x08, 0x16, 0xca, 0x22, 0x78, 0x22, 0x92, 0x4f,
+  0x6a, 0xd3, 0xf3, 0x4b, 0x23, 0xca, 0xe8, 0xe5, 0xdf, 0x44, 0x9c, 0x60,
+  0xca, 0x59, 0x26, 0x80, 0xb1, 0xb6, 0x8f, 0x56, 0x28, 0xda, 0xfe, 0xdc,
+  0xd4, 0xbf, 0x3e, 0xd1, 0x45, 0x80, 0x1d, 0xc7, 0xdf, 0xcf, 0x26, 0x05,
+  0x32, 0x06, 0xde, 0xee, 0x47, 0x3d, 0xc8, 0x1e, 0x2c, 0x23, 0x60, 0x43,
+  0x08, 0x40, 0x96, 0x39, 0x97, 0x0f, 0xe3, 0xde, 0x7a, 0x38, 0x50, 0x7f,
+  0xa6, 0xe6, 0x16, 0x9d, 0x05, 0x03, 0xe8, 0x3a, 0x4e, 0x1c, 0x4e, 0xf5,
+  0xb2, 0xa0, 0xb9, 0x61, 0xd3, 0xd0, 0x0d, 0x64, 0x42, 0x1c, 0xac, 0x86,
+  0xc6, 0x22, 0xd4, 0x4a, 0xdf, 0x4b, 0x0b, 0x30, 0x99, 0x24, 0x92, 0x81,
+  0x7f, 0xc4, 0xd3, 0x88, 0x95, 0xba, 0x4b, 0x8d, 0x47, 0x06, 0xf6, 0x9c,
+  0xec, 0x40, 0x6a, 0xd8, 0x95, 0x31, 0x18, 0x80, 0x38, 0x61, 0x2a, 0xf0,
+  0xad, 0x78, 0x6b, 0x25, 0x5a, 0xb7, 0x17, 0x1c, 0x5d, 0x77, 0x32, 0x9a,
+  0x8a, 0xc5, 0x2c, 0x79, 0xaa, 0xc9, 0x72, 0x82, 0x5e, 0x0f, 0xa1, 0x55,
+  0x21, 0x49, 0xdb, 0x19, 0xa3, 0x65, 0x92, 0xec, 0x0b, 0xa3, 0xfc, 0x3f,
+  0x08, 0x7a, 0xd4, 0x90, 0xc2, 0xad, 0x4f, 0x59, 0x60, 0x86, 0xec, 0x27,
+  // 16
+  0x40, 0xd7, 0x23, 0x2c, 0xfa, 0x52, 0x84, 0x70, 0x9e, 0x25, 0x08, 0x9d,
+  0x29, 0xd0, 0x61, 0xc8, 0x96, 0x79, 0x2e, 0xb6, 0x42, 0xf9, 0xa9, 0x1f,
+  0x4c, 0x83, 0x82, 0x95, 0x34, 0x4d, 0x55, 0xe0, 0x6d, 0xe1, 0x83, 0x5f,
+  0x0d, 0x57, 0xd2, 0x0a, 0x74, 0x97, 0xef, 0xcd, 0xbe, 0x78, 0x19, 0x87,
+  0x90, 0x02, 0xe5, 0xcc, 0x63, 0x7d, 0xc2, 0x05, 0xf4, 0xbb, 0x46, 0xe0,
+  0x36, 0xc9, 0x80, 0xe7, 0xcf, 0x0c, 0x13, 0x6c, 0x25, 0x78, 0xbe, 0x0e,
+  0x60, 0x02, 0xfc, 0xc7, 0x22, 0x71, 0x4a, 0xa8, 0x61, 0x4a, 0x3b, 0x94,
+  0x0c, 0x1b, 0xd4, 0x9e, 0x0a, 0x55, 0x48, 0x74, 0xce, 0x38, 0xe9, 0xc1,
+  0x88, 0x6f, 0x46, 0xfb, 0xa7, 0xe2, 0x04, 0xd3, 0x15, 0xdb, 0x71, 0xa2,
+  0x81, 0xe0, 0x29, 0x12, 0x00, 0x07, 0x26, 0x9c, 0x6d, 0xd2, 0x21, 0x7c,
+  0xd2, 0xbf, 0xed, 0x44, 0x9d, 0x2a, 0x55, 0x99, 0x5b, 0xee, 0x41, 0x18,
+  0x5c, 0x23, 0xb7, 0x96, 0x22, 0x72, 0x8d, 0x49, 0x8a, 0x17, 0x57, 0x97,
+  0x9f, 0x69, 0x02, 0x62, 0x55, 0x7f, 0xac, 0x26, 0x3c, 0xa9, 0x61, 0xcc,
+  0xe2, 0x15, 0x3f, 0xc2, 0x0d, 0x8c, 0x9f, 0x90, 0x4a, 0xde, 0xba, 0xb0,
+  0xc8, 0xad, 0x13, 0xa2, 0xe7, 0x44, 0x21, 0x1d, 0x09, 0x2a, 0x1c, 0x5e,
+  0x5b, 0x10, 0x8f, 0xe3, 0x61, 0xcd, 0xf7, 0xb8, 0x69, 0xac, 0xc8, 0x25,
+  0x45, 0x2a, 0x82, 0x16, 0x08, 0xb8, 0xfb, 0xe5, 0xb6, 0x65, 0xec, 0x87,
+  0xd3, 0x8a, 0xff, 0xab, 0x4a, 0x64, 0xeb, 0xd1, 0x20, 0xef, 0x17, 0x36,
+  0x19, 0xf2, 0x86, 0x81, 0x29, 0xb8, 0x94, 0xfc, 0xfa, 0x18, 0xea, 0x36,
+  0x54, 0x5e, 0x5f, 0x8b, 0xce, 0x37, 0x12, 0xc2, 0xa6, 0x6f, 0xf2, 0x88,
+  0xde, 0x47, 0xaf, 0x75, 0xcc, 0xad, 0x2c, 0xf9, 0xb8, 0xc1, 0x9b, 0x8b,
+  0x17, 0xf9, 0x95, 0x11, 0xa3, 0xfe, 0x09, 0x4f, 0xd3, 0x8f, 0x13, 0x89,
+  0xe7, 0x82, 0x99, 0xa5, 0xc6, 0x99, 0x7a, 0xb4, 0xeb, 0xb7, 0x36, 0x2b,
+  0xa8, 0x14, 0xd3, 0x78, 0xde, 0xb8, 0xd2, 0x26, 0x21, 0x4c, 0xb6, 0x24,
+  0xc4, 0x27, 0xbb, 0x0b, 0x94, 0x3c, 0x47, 0x08, 0x10, 0x3f, 0x90, 0xb4,
+  0x6e, 0x83, 0x30, 0x41, 0x33, 0x8b, 0x58, 0x6d, 0x72, 0x13, 0xb1, 0x67,
+  0x7e, 0xc2, 0x41, 0x23, 0x4e, 0x9e, 0x73, 0xe3, 0xa5, 0x17, 0xe5, 0xc6,
+  0x26, 0x45, 0xce, 0xb0, 0xdb, 0xc5, 0xad, 0x68, 0x74, 0x1e, 0xf9, 0xc7,
+  0xa6, 0xf0, 0x71, 0xdc, 0xc8, 0xf9, 0x19, 0x98, 0x68, 0x20, 0x7e, 0x37,
+  0xbb, 0x4e, 0x8a, 0x6a, 0x84, 0x2d, 0xf5, 0x90, 0xeb, 0x0b, 0xb0, 0xec,
+  0x55, 0x6b, 0xf5, 0xd3, 0xa6, 0xdb, 0x21, 0x59, 0x40, 0x2d, 0xab, 0x6f,
+  0xe7, 0xd5, 0xb1, 0xc0, 0xea, 0x7b, 0xde, 0x63, 0xf4, 0xa1, 0x92, 0x1d,
+  // 17
+  0x44, 0x33, 0xaf, 0xe0, 0xe3, 0x9c, 0x96, 0x33, 0x4d, 0xa9, 0x50, 0x6f,
+  0xaf, 0xa9, 0x26, 0xb6, 0x2b, 0x97, 0x87, 0x03, 0xce, 0x04, 0x30, 0xcb,
+  0x55, 0x8f, 0x3e, 0xe1, 0x7b, 0x1a, 0xe0, 0xee, 0x23, 0x5b, 0xd2, 0x35,
+  0x07, 0xa3, 0x7f, 0x11, 0xf5, 0xad, 0xa6, 0x8b, 0x2a, 0x24, 0x7a, 0xc7,
+  0xe0, 0x79, 0x63, 0x4a, 0x24, 0x3a, 0x87, 0x02, 0x97, 0x7d, 0x57, 0xf3,
+  0x1f, 0x90, 0x70, 0x4f, 0xbb, 0x5b, 0x2b, 0xaf, 0x4e, 0x09, 0xf4, 0x01,
+  0xfb, 0x89, 0x3a, 0x6d, 0x49, 0xd7, 0xf6, 0x82, 0xf2, 0x26, 0xe6, 0xfa,
+  0x96, 0x53, 0x39, 0xab, 0x27, 0xab, 0x0d, 0x91, 0x13, 0x15, 0xd8, 0xd9,
+  0xbb, 0xf3, 0xf6, 0xee, 0xec, 0xe0, 0x78, 0x79, 0xbe, 0xaa, 0x14, 0x1b,
+  0x0d, 0x15, 0xad, 0x73, 0xb6, 0xfb, 0x5a, 0xbc, 0x38, 0x36, 0x4c, 0x32,
+  0x5b, 0xbf, 0x25, 0x9e, 0x70, 0x6f, 0xec, 0xf9, 0x32, 0xcc, 0xfd, 0x43,
+  0xb0, 0x5c, 0xc2, 0x54, 0x43, 0x26, 0x82, 0xc6, 0xb5, 0x4f, 0xe6, 0x96,
+  0x99, 0xa7, 0xae, 0xc7, 0xce, 0xda, 0xaf, 0x29, 0x12, 0xeb, 0xf5, 0xaa,
+  0x49, 0xe4, 0xec, 0x0e, 0xa4, 0xe9, 0xf4, 0xca, 0x05, 0xc3, 0x0f, 0x06,
+  0x84, 0x55, 0x2c, 0xe0, 0x39, 0x98, 0x0d, 0x8c, 0x3c, 0x5e, 0x21, 0xce,
+  0xfd, 0x3a, 0xad, 0xf4, 0xb6, 0x75, 0x78, 0x53, 0xe2, 0x29, 0x1a, 0x7e,
+  0x76, 0x36, 0x13, 0x42, 0x13, 0x8e, 0x65, 0x78, 0xf4, 0xd6, 0x1b, 0x04,
+  0x35, 0xaf, 0x5b, 0xc8, 0xbe, 0x33, 0x3d, 0x25, 0x35, 0x5f, 0x21, 0x44,
+  0xa3, 0x90, 0xd4, 0x8f, 0x3b, 0x42, 0xd1, 0xd8, 0xa8, 0xe7, 0x49, 0x92,
+  0xbb, 0x42, 0x72, 0xd5, 0xf1, 0x41, 0x37, 0xb4, 0xa7, 0x35, 0xb7, 0x9c,
+  0x41, 0xf3, 0xde, 0xf2, 0x74, 0xb7, 0x1c, 0xb2, 0xee, 0x94, 0xf2, 0xaa,
+  0x73, 0x8f, 0x6f, 0x24, 0x8b, 0xa1, 0x0c, 0xe3, 0x42, 0xae, 0xa7, 0x4c,
+  0x98, 0x91, 0x7b, 0x38, 0x88, 0x23, 0x76, 0x7e, 0x0f, 0xa9, 0x9d, 0x82,
+  0xeb, 0x62, 0x14, 0xde, 0xa6, 0x05, 0x0b, 0x38, 0xff, 0x9d, 0xa9, 0xf0,
+  0x28, 0xd0, 0xf8, 0xad, 0x0a, 0x24, 0x2f, 0x51, 0x32, 0xb1, 0x3e, 0xa5,
+  0xde, 0x6a, 0x8f, 0xa8, 0x32, 0xd4, 0xe7, 0xfd, 0x1f, 0x8f, 0x88, 0x99,
+  0x88, 0x9b, 0x4b, 0xa9, 0xaf, 0x8e, 0x3b, 0x0d, 0x61, 0x01, 0x7a, 0x6b,
+  0x80, 0x94, 0x9f, 0x0f, 0xf8, 0xbd, 0x37, 0xf2, 0x2d, 0x1f, 0xc0, 0xd9,
+  0x86, 0xd1, 0x21, 0xf8, 0x72, 0x7c, 0x22, 0x8d, 0x91, 0x98, 0xee, 0x55,
+  0xed, 0xaf, 0x6d, 0x32, 0x8c, 0x03, 0x7c, 0x34, 0x22, 0x54, 0xc9, 0x6c,
+  0x67, 0x40, 0x71, 0x25, 0x61, 0x4a, 0x96, 0x2f, 0xf5, 0x61, 0x88, 0x0e,
+  0xdd, 0xf1, 0xa5, 0xf9, 0x94, 0x6b, 0x57, 0xf3, 0xc7, 0x27, 0xda, 0x92,
+  // 18
+  0x4d, 0x10, 0xba, 0x84, 0xe1, 0xa5, 0x9c, 0x4d, 0xdb, 0x59, 0xe0, 0x64,
+  0x27, 0x71, 0x19, 0xcd, 0xc7, 0x8b, 0xba, 0x4e, 0x49, 0x5e, 0xc6, 0x75,
+  0xb6, 0xf3, 0x9c, 0x48, 0x89, 0xe8, 0x87, 0x79, 0xf3, 0x97, 0x67, 0x64,
+  0xe8, 0xc6, 0x8e, 0x7f, 0x18, 0x08, 0x14, 0x46, 0x67, 0x2f, 0xac, 0xe7,
+  0x45, 0x2f, 0x1c, 0x67, 0x9a, 0x06, 0xeb, 0xe7, 0x8f, 0x72, 0x0f, 0xb4,
+  0x26, 0xcf, 0x4d, 0xdd, 0xb0, 0x0d, 0x12, 0x69, 0x95, 0x63, 0x3d, 0x88,
+  0x28, 0x6f, 0xdd, 0x08, 0xae, 0xa5, 0x57, 0xb4, 0xcb, 0x85, 0xcc, 0x9b,
+  0xc9, 0x81, 0xb0, 0xb4, 0xf7, 0xb5, 0x12, 0x28, 0x0d, 0x5c, 0xc6, 0xf0,
+  0x84, 0xc8, 0x3b, 0x66, 0x50, 0xc3, 0x6d, 0x62, 0x1a, 0x4b, 0xea, 0xb1,
+  0xfa, 0x5e, 0xb5, 0x8b, 0xed, 0x4b, 0x4f, 0xf3, 0xee, 0xea, 0xa0, 0x92,
+  0xb3, 0xc4, 0x31, 0x2a, 0xcf, 0x54, 0x69, 0xb2, 0x76, 0xd6, 0xd6, 0x06,
+  0xba, 0x96, 0x75, 0xf7, 0xef, 0xf8, 0x9c, 0x5b, 0x8a, 0x24, 0x35, 0x07,
+  0x6b, 0xdf, 0x1e, 0xa7, 0x15, 0xcb, 0xe8, 0x1e, 0x5e, 0x1a, 0x8c, 0xf7,
+  0xe5, 0x0d, 0x77, 0xce, 0xc6, 0xd2, 0x72, 0x91, 0x09, 0xa8, 0x8d, 0x5f,
+  0xb2, 0xf2, 0x00, 0xc2, 0x52, 0x09, 0xfb, 0x52, 0xd1, 0x15, 0x28, 0x3c,
+  0x82, 0xd7, 0x09, 0x3f, 0x9f, 0xac, 0xb9, 0xcf, 0x60, 0xa5, 0xcb, 0x50,
+  0x1c, 0x44, 0xc9, 0xd1, 0x96, 0xec, 0x3a, 0x90, 0x66, 0xee, 0x46, 0x33,
+  0xa6, 0x9d, 0x24, 0xbf, 0xe9, 0x9b, 0x3f, 0x80, 0xc7, 0xee, 0x88, 0xcc,
+  0x63, 0x0a, 0x46, 0xe3, 0xe4, 0xff, 0x91, 0x73, 0x38, 0xc9, 0xd6, 0x3d,
+  0xa4, 0x99, 0x47, 0xe2, 0x18, 0x8a, 0xf2, 0xe8, 0xde, 0xb7, 0x19, 0xaf,
+  0x5a, 0x23, 0x53, 0xa2, 0x8f, 0x21, 0xdd, 0x7c, 0xa6, 0xab, 0x73, 0x71,
+  0x8a, 0x00, 0x5f, 0x2d, 0x75, 0x1c, 0x76, 0xe0, 0xfc, 0x26, 0x46, 0xce,
+  0x7b, 0x3c, 0x35, 0x6a, 0x3d, 0x7c, 0xf4, 0x43, 0xce, 0x06, 0x9b, 0xf8,
+  0xca, 0xb5, 0xc6, 0x69, 0x8d, 0x56, 0x1a, 0x54, 0x73, 0xd8, 0xd8, 0x08,
+  0xb6, 0x16, 0xb7, 0x30, 0x2b, 0xe5, 0x05, 0xa5, 0xde, 0xd4, 0x2a, 0x4a,
+  0xdb, 0x2b, 0x25, 0x8e, 0x82, 0x5d, 0x02, 0x40, 0x37, 0x83, 0x57, 0xd2,
+  0xc6, 0x57, 0x1d, 0x0c, 0xf8, 0x82, 0x70, 0x89, 0x84, 0xc1, 0xf8, 0x32,
+  0x58, 0x40, 0xc8, 0xef, 0x5d, 0xed, 0xd0, 0x17, 0x21, 0x3b, 0x16, 0x80,
+  0x52, 0x3f, 0x06, 0x89, 0x6c, 0x70, 0xb3, 0xd1, 0x5f, 0xba, 0xe7, 0x4f,
+  0xb1, 0xcb, 0x9e, 0x1f, 0xf6, 0x5e, 0x21, 0x12, 0xc6, 0xe2, 0x12, 0x59,
+  0x86, 0xf6, 0xf1, 0xb2, 0x91, 0x1e, 0x28, 0xc0, 0x21, 0x48, 0x65, 0xa3,
+  0x41, 0xad, 0xd4, 0x3c, 0xfa, 0x02, 0x7d, 0x5c, 0x9d, 0x5a, 0x3d, 0xcd,
+  // 19
+  0x81, 0x53, 0xa4, 0x98, 0x68, 0x3c, 0x0d, 0x85, 0x7f, 0xb1, 0x87, 0x52,
+  0xa3, 0xcc, 0xbe, 0xd0, 0x20, 0xf4, 0x40, 0xfb, 0xed, 0xfd, 0xc3, 0x7b,
+  0x69, 0xbf, 0xbf, 0x62, 0x27, 0x22, 0xd8, 0xed, 0xbf, 0xe9, 0x46, 0x52,
+  0x50, 0xcd, 0x2d, 0x59, 0x26, 0xde, 0x5c, 0xe6, 0x75, 0xba, 0x5b, 0xa6,
+  0x6a, 0x56, 0x74, 0x52, 0x34, 0xe8, 0x58, 0x6a, 0x9d, 0x0f, 0x44, 0x16,
+  0xcf, 0xad, 0x71, 0x1d, 0x20, 0x60, 0x26, 0xa2, 0x7d, 0x9e, 0x71, 0x62,
+  0xe5, 0xa9, 0x9b, 0xb5, 0x06, 0xdc, 0x37, 0xc1, 0x05, 0x50, 0xbc, 0x21,
+  0x49, 0x50, 0x86, 0x1d, 0xca, 0x89, 0xfe, 0x11, 0x4e, 0xc9, 0x2a, 0xc4,
+  0xa9, 0xb0, 0xbd, 0x04, 0x39, 0x47, 0x83, 0x44, 0xd4, 0xdc, 0x71, 0x68,
+  0x67, 0x8e, 0x6b, 0xd5, 0x59, 0x50, 0x29, 0x71, 0xbd, 0xb0, 0xc7, 0x9f,
+  0xc0, 0xd4, 0x79, 0x1d, 0x6b, 0x42, 0x51, 0x76, 0xb9, 0x57, 0xe5, 0xeb,
+  0x88, 0x9a, 0x7a, 0x3d, 0x46, 0xc4, 0xce, 0x20, 0xb5, 0x90, 0x39, 0xc5,
+  0x97, 0xf6, 0x3c, 0x1f, 0x90, 0x57, 0xdb, 0x01, 0xba, 0x21, 0xcd, 0x81,
+  0x58, 0xbe, 0x04, 0x4e, 0x43, 0x47, 0x13, 0xcd, 0xbf, 0xb4, 0x2c, 0x71,
+  0x17, 0xad, 0xce, 0x7d, 0x4f, 0x75, 0x50, 0x99, 0x23, 0xf5, 0x5d, 0x25,
+  0xc4, 0x1b, 0x0c, 0xc1, 0xeb, 0xcf, 0x42, 0xc6, 0xb5, 0x06, 0x2a, 0x54,
+  0xa9, 0xb9, 0x79, 0xeb, 0xda, 0x8e, 0x9e, 0xce, 0x67, 0x7f, 0xdb, 0x5f,
+  0x55, 0x0a, 0x15, 0x2f, 0xda, 0x42, 0xdf, 0x93, 0x78, 0x5c, 0x59, 0x34,
+  0x11, 0x07, 0x96, 0x7c, 0xe3, 0xa5, 0xc0, 0x27, 0xe2, 0x5b, 0xe5, 0xb7,
+  0x4c, 0x68, 0xfc, 0x85, 0x64, 0xe4, 0x98, 0x73, 0xc0, 0x99, 0x7b, 0x5c,
+  0xad, 0x3e, 0x13, 0xd2, 0x40, 0xfe, 0x8f, 0x41, 0x94, 0x26, 0x2a, 0x2a,
+  0xad, 0xb1, 0x61, 0xaf, 0xa1, 0x39, 0x30, 0xb9, 0x0d, 0xa2, 0xa7, 0xa3,
+  0x7b, 0x31, 0x86, 0x0e, 0xda, 0x94, 0xd6, 0x48, 0x7b, 0x36, 0x9a, 0x84,
+  0x98, 0x86, 0xd3, 0x92, 0x0f, 0x17, 0x74, 0x20, 0x9c, 0x5a, 0x53, 0x63,
+  0xe2, 0x7b, 0xe5, 0x64, 0x00, 0x6f, 0xe8, 0x66, 0x3b, 0x98, 0x3e, 0x95,
+  0xfd, 0xb2, 0x5a, 0x2a, 0xbc, 0xed, 0x39, 0x1a, 0xfa, 0xbd, 0xc8, 0xb1,
+  0xee, 0x83, 0x97, 0x3a, 0x01, 0x02, 0x2a, 0x4a, 0xbf, 0x53, 0xd6, 0x88,
+  0x7a, 0x7b, 0x82, 0x48, 0x83, 0x85, 0xe5, 0x5b, 0x8e, 0xac, 0x50, 0x74,
+  0xdf, 0x5a, 0x09, 0x57, 0xa3, 0xd2, 0x25, 0xaa, 0x67, 0x9c, 0xfb, 0xcd,
+  0xbe, 0x20, 0xcf, 0xbd, 0xc6, 0xf4, 0x55, 0xbd, 0x6d, 0x84, 0xb0, 0x8e,
+  0x5e, 0xf7, 0x5c, 0x7f, 0xf4, 0x99, 0xbb, 0x32, 0x5a, 0xe7, 0x2b, 0x0f,
+  0x9f, 0x2a, 0x52, 0x65, 0xe2, 0x0c, 0x72, 0xcf, 0x12, 0xc3, 0x35, 0x02,
+  // 20
+  0xe3, 0x1f, 0x67, 0xbf, 0x48, 0xfc, 0xdf, 0x7c, 0x94, 0x48, 0xbb, 0xe5,
+  0xf9, 0x97, 0xd6, 0x01, 0xd7, 0x3a, 0xcc, 0x98, 0x00, 0xb9, 0x15, 0xc5,
+  0xbf, 0xd7, 0x18, 0x97, 0x74, 0xcc, 0xf1, 0x31, 0x1e, 0x49, 0xe3, 0xb3,
+  0xd3, 0x8f, 0xc4, 0xc8, 0x4f, 0xbe, 0xa4, 0x30, 0xd2, 0xb4, 0x7a, 0x5b,
+  0xd3, 0x91, 0x1d, 0xcb, 0x1c, 0x45, 0xda, 0xda, 0x90, 0x27, 0x24, 0x2c,
+  0xc1, 0x03, 0x27, 0xc6, 0x7e, 0xc1, 0xdc, 0xc8, 0x35, 0x36, 0x13, 0x80,
+  0x89, 0x8d, 0xb9, 0xde, 0x3e, 0xcb, 0x89, 0x9d, 0x5b, 0xc2, 0xad, 0x1a,
+  0x55, 0xc1, 0x2e, 0x3b, 0x94, 0x3f, 0x6a, 0x34, 0xfd, 0x12, 0xf4, 0xfb,
+  0x46, 0xc0, 0xbf, 0x86, 0x74, 0xbe, 0x07, 0x82, 0x09, 0x65, 0x00, 0x8c,
+  0x76, 0xde, 0x61, 0x99, 0x5d, 0x6f, 0x5c, 0x40, 0xc4, 0x3f, 0x3f, 0x32,
+  0xaf, 0x13, 0x58, 0x67, 0xf7, 0x4a, 0x10, 0x6a, 0xb5, 0x00, 0xd7, 0xf9,
+  0x68, 0x1f, 0x25, 0xe5, 0x79, 0xdc, 0x3e, 0xcd, 0x22, 0x60, 0x22, 0x77,
+  0x5f, 0xcc, 0x12, 0x5b, 0xdc, 0x19, 0x1f, 0x2e, 0xca, 0xd2, 0xef, 0x41,
+  0x98, 0x34, 0x51, 0xb1, 0x42, 0x46, 0x84, 0x03, 0xa4, 0xe1, 0x75, 0x05,
+  0x1b, 0xcb, 0xfb, 0x51, 0x13, 0x87, 0xdf, 0x75, 0x61, 0x73, 0x32, 0x9d,
+  0xa5, 0xfd, 0x53, 0x5d, 0x90, 0x29, 0xcc, 0x4c, 0xe0, 0x1c, 0x25, 0xf3,
+  0xc5, 0x9e, 0x8c, 0x7c, 0x1e, 0xde, 0xc8, 0x91, 0xa0, 0x31, 0xbb, 0x82,
+  0x3d, 0x56, 0xad, 0xf7, 0x80, 0x8b, 0x69, 0x56, 0x5e, 0x8f, 0x9f, 0x09,
+  0x87, 0x0c, 0xbd, 0x75, 0xf2, 0xea, 0xed, 0x4a, 0x06, 0x0d, 0x05, 0x67,
+  0x5e, 0x32, 0xa7, 0x71, 0xa6, 0x10, 0x95, 0x6d, 0x17, 0x8d, 0xdf, 0x16,
+  0x32, 0xdb, 0x29, 0xb3, 0x0a, 0x6c, 0xeb, 0x9b, 0x3a, 0xf3, 0xd4, 0x5c,
+  0x63, 0x47, 0x34, 0xa3, 0x18, 0x6b, 0x0d, 0x53, 0xa3, 0x21, 0x38, 0x53,
+  0xbc, 0x8a, 0x5e, 0xf5, 0x1f, 0xf0, 0x0b, 0x8b, 0x6e, 0x6f, 0xa7, 0x14,
+  0xb3, 0xf0, 0x2a, 0xc0, 0x18, 0x88, 0x04, 0x6f, 0x6d, 0x25, 0xe1, 0xae,
+  0x91, 0xe8, 0x20, 0x58, 0xef, 0xd4, 0x06, 0xcc, 0xd2, 0xf1, 0xb6, 0xef,
+  0xd1, 0x6e, 0x68, 0x12, 0x9c, 0x3d, 0x3c, 0x1e, 0xe1, 0xfc, 0x8f, 0x22,
+  0x96, 0x4c, 0x20, 0xcc, 0x3f, 0xb4, 0xb3, 0xf1, 0x3e, 0x0d, 0x7f, 0x3e,
+  0x4c, 0xd7, 0xc9, 0x71, 0x72, 0x37, 0x33, 0xa2, 0x5a, 0xe1, 0x70, 0x0d,
+  0xb9, 0xd4, 0x44, 0xfe, 0xa6, 0x20, 0x4d, 0xa0, 0x41, 0x3b, 0x45, 0xd3,
+  0xee, 0x3a, 0xaf, 0x68, 0x2f, 0xf8, 0x14, 0x56, 0xf8, 0x0f, 0x7d, 0x0b,
+  0x55, 0x96, 0xf3, 0x68, 0x70, 0x55, 0x5d, 0x79, 0x5e, 0xa4, 0xff, 0xc5,
+  0x36, 0x75, 0xc1, 0x83, 0xb9, 0x17, 0x8e, 0x9f, 0x05, 0x20, 0xb7, 0x3d,
+  // 21
+  0x6f, 0x9d, 0x06, 0xbc, 0x6c, 0xf0, 0x5d, 0x6f, 0xc1, 0x2c, 0x40, 0xf5,
+  0x5a, 0x54, 0x25, 0x36, 0x21, 0x0c, 0x74, 0xca, 0x00, 0x2c, 0xf9, 0x98,
+  0x1b, 0x2a, 0x42, 0xd3, 0x1e, 0x61, 0x84, 0x25, 0x8f, 0x42, 0x77, 0xea,
+  0x35, 0x80, 0x6b, 0x60, 0x49, 0x91, 0x13, 0x0d, 0xe4, 0xb6, 0x50, 0x53,
+  0x63, 0x81, 0x2e, 0x28, 0x58, 0x74, 0x39, 0xd8, 0x10, 0x17, 0x8b, 0x27,
+  0xfb, 0x93, 0x76, 0x03, 0x3a, 0x44, 0x7a, 0x33, 0x54, 0xc7, 0x58, 0x6b,
+  0x1d, 0xad, 0xcb, 0x7d, 0xb0, 0x7f, 0xb4, 0xf6, 0xf9, 0x9c, 0x55, 0xdd,
+  0x13, 0xe6, 0x31, 0x7d, 0xb5, 0x3f, 0xa0, 0x2d, 0x21, 0x43, 0xe9, 0x30,
+  0xa8, 0xe2, 0x0d, 0xb2, 0xdd, 0x8f, 0xa6, 0xf3, 0x74, 0x7c, 0x72, 0x78,
+  0x61, 0x2b, 0x68, 0x65, 0xae, 0x8b, 0x33, 0xfc, 0x21, 0xaa, 0xcf, 0x06,
+  0x63, 0x5e, 0xc7, 0x25, 0x4e, 0xe3, 0x55, 0xff, 0x25, 0x9b, 0x17, 0x06,
+  0x97, 0x44, 0x6f, 0x11, 0xbc, 0xf4, 0x3b, 0x5d, 0xb7, 0x4d, 0x6e, 0xd6,
+  0xd1, 0x66, 0xe7, 0x3b, 0xd9, 0xee, 0xe5, 0x91, 0x84, 0x92, 0xde, 0xef,
+  0x76, 0xf0, 0x4d, 0x87, 0xd0, 0x0b, 0xef, 0xf4, 0x76, 0x0c, 0xef, 0x63,
+  0xee, 0xcb, 0x13, 0x5c, 0x36, 0xb4, 0xfd, 0x37, 0x21, 0x6e, 0x4c, 0xf1,
+  0x15, 0x92, 0x1a, 0xe3, 0x06, 0x8f, 0x84, 0x67, 0xa7, 0xb1, 0x84, 0xd3,
+  0x4d, 0x9e, 0xe1, 0xbc, 0x3a, 0x1f, 0xd2, 0xc9, 0xb4, 0x5a, 0x9a, 0xff,
+  0x82, 0x92, 0xdb, 0x96, 0xab, 0xa3, 0x96, 0xee, 0x1b, 0x9c, 0xd0, 0x08,
+  0x2a, 0x90, 0x83, 0x73, 0x69, 0x36, 0x46, 0x11, 0x37, 0xeb, 0xf5, 0x11,
+  0x2c, 0xa7, 0x99, 0xa3, 0xe7, 0x0a, 0x52, 0xbf, 0x11, 0xdd, 0x47, 0x2e,
+  0xa8, 0x7d, 0x97, 0x15, 0x09, 0x75, 0x89, 0x51, 0x71, 0xf6, 0xc9, 0x99,
+  0xdf, 0x22, 0x1e, 0x60, 0xd8, 0xc2, 0xbb, 0xf2, 0xb3, 0x33, 0x30, 0x0e,
+  0xfa, 0xc5, 0xc6, 0xb8, 0x3c, 0x40, 0x7d, 0x8e, 0xfc, 0x84, 0x7e, 0x0a,
+  0x0f, 0x98, 0xa3, 0xc9, 0xac, 0x4b, 0xd8, 0x16, 0x86, 0x35, 0xd5, 0x4a,
+  0x29, 0xb1, 0xe7, 0x89, 0x42, 0xff, 0x52, 0xa3, 0xa4, 0x86, 0x3f, 0x2d,
+  0xee, 0x92, 0x81, 0xe5, 0xd1, 0xa2, 0xe4, 0x01, 0xfe, 0xa3, 0x11, 0xfd,
+  0x2a, 0xbc, 0xbb, 0xe1, 0xd8, 0x5f, 0x62, 0x22, 0xd4, 0x6b, 0x72, 0x6a,
+  0x85, 0x15, 0x45, 0xa5, 0xf2, 0x97, 0x55, 0xcb, 0x68, 0x7a, 0xb0, 0x11,
+  0xb1, 0xa0, 0xfb, 0x9b, 0x55, 0x1c, 0x0e, 0x6f, 0x6a, 0x02, 0x3a, 0x20,
+  0xbb, 0xc0, 0x51, 0x80, 0xcc, 0x4f, 0x27, 0x31, 0x04, 0xb6, 0xc4, 0x73,
+  0x9c, 0x85, 0x51, 0x16, 0xad, 0xb6, 0x91, 0x25, 0xab, 0x2d, 0xba, 0x57,
+  0x6b, 0x61, 0x7c, 0x66, 0x9d, 0x75, 0xc9, 0x1b, 0x19, 0xa3, 0x94, 0x35,
+  // 22
+  0x67, 0x76, 0xd9, 0xc2, 0x40, 0x65, 0x92, 0x0b, 0xdc, 0x66, 0xf2, 0x9e,
+  0x8d, 0x18, 0xec, 0x7f, 0x05, 0xdd, 0xe4, 0xf4, 0x8f, 0x15, 0xe4, 0x8e,
+  0x52, 0x04, 0x87, 0x5a, 0xcc, 0x41, 0x2d, 0x09, 0xfc, 0x44, 0xe7, 0x8d,
+  0xa5, 0x79, 0xcd, 0x11, 0x36, 0xd8, 0x47, 0xf9, 0x66, 0x03, 0x54, 0x1f,
+  0xf9, 0x27, 0xcc, 0x2a, 0x95, 0xcb, 0x72, 0x10, 0x26, 0x77, 0x64, 0xa8,
+  0x5e, 0xf1, 0xa5, 0x94, 0x6e, 0x7c, 0x1a, 0x16, 0x47, 0x39, 0xf5, 0x1a,
+  0xa0, 0x2b, 0xf6, 0x18, 0xc1, 0x13, 0xc9, 0x8c, 0x21, 0x5f, 0xed, 0x09,
+  0xdf, 0xcc, 0x58, 0xde, 0x1f, 0x94, 0x20, 0x75, 0xc1, 0x68, 0x68, 0xb9,
+  0xba, 0xdb, 0x45, 0xfc, 0x41, 0xc6, 0x19, 0x28, 0xc2, 0x34, 0x6d, 0xb5,
+  0x6d, 0x48, 0xea, 0xad, 0x85, 0xdb, 0x5b, 0x49, 0x2f, 0x4d, 0x8d, 0xf1,
+  0x2b, 0xe0, 0x02, 0xbf, 0xb5, 0x0e, 0x0d, 0xa2, 0x56, 0xab, 0x2d, 0xe9,
+  0xf5, 0x8b, 0x47, 0x32, 0x7a, 0x20, 0xa0, 0x74, 0x81, 0xdb, 0xb1, 0x01,
+  0x4a, 0x68, 0x7a, 0x52, 0x2f, 0x91, 0xe1, 0xaa, 0xa3, 0xa1, 0x50, 0x8c,
+  0x57, 0x68, 0x56, 0xc3, 0x10, 0x04, 0xf2, 0x9d, 0xc9, 0xf6, 0xdb, 0x5c,
+  0xd7, 0xdf, 0xda, 0x6f, 0xd7, 0xee, 0x47, 0x7a, 0xa9, 0x79, 0x07, 0xec,
+  0x4c, 0xf2, 0xcf, 0xb2, 0xce, 0x89, 0x7b, 0x2e, 0xfb, 0x2d, 0x73, 0x09,
+  0xec, 0x69, 0x49, 0x5f, 0x97, 0x1b, 0x01, 0xa0, 0xd1, 0xde, 0x62, 0x1e,
+  0x1f, 0xb0, 0x57, 0xcd, 0xf8, 0x1b, 0xd3, 0x3b, 0xb5, 0x0f, 0x51, 0xd4,
+  0xf6, 0x97, 0xae, 0xed, 0x9a, 0x11, 0xe9, 0x42, 0x85, 0xd7, 0x6e, 0xc6,
+  0x47, 0xdb, 0x2a, 0x69, 0x3f, 0x4e, 0x80, 0x5d, 0x80, 0xfb, 0x22, 0x84,
+  0x5e, 0x1b, 0xcc, 0x58, 0xb3, 0xb9, 0xd0, 0xd8, 0x0c, 0x4d, 0x83, 0xe8,
+  0xa9, 0x7b, 0x0d, 0xeb, 0xb1, 0x45, 0x33, 0xa3, 0x21, 0x0b, 0x4c, 0x04,
+  0xc0, 0x0f, 0xa6, 0x7e, 0x66, 0x6a, 0x52, 0x59, 0xe0, 0x7f, 0xff, 0xfe,
+  0x04, 0x52, 0x87, 0x28, 0x9e, 0xd3, 0x14, 0x04, 0x73, 0x1c, 0x1b, 0x13,
+  0xc7, 0x54, 0x10, 0x20, 0x00, 0x01, 0x51, 0xd9, 0xf5, 0x09, 0xf1, 0xba,
+  0x30, 0x52, 0x2c, 0xa8, 0x79, 0x6f, 0x97, 0x87, 0xb6, 0x13, 0x90, 0x15,
+  0x8f, 0x9e, 0x53, 0x76, 0x49, 0x9a, 0xc0, 0x7f, 0x1a, 0xb2, 0xe9, 0xe1,
+  0x5a, 0x74, 0xde, 0x3b, 0xe4, 0x20, 0x2c, 0x29, 0xd8, 0x4d, 0xcc, 0x07,
+  0x40, 0x09, 0xca, 0xba, 0xd4, 0x18, 0xf3, 0x57, 0x11, 0x2c, 0x31, 0xff,
+  0xa5, 0xe8, 0xbd, 0xf1, 0x9f, 0x13, 0xa6, 0xa8, 0xb7, 0xf7, 0x16, 0x10,
+  0xe3, 0x59, 0x6d, 0xd3, 0x60, 0x37, 0x41, 0x85, 0x4c, 0x74, 0x84, 0x50,
+  0xc0, 0x01, 0xff, 0x81, 0xcb, 0xb8, 0xc0, 0x2e, 0x88, 0xe4, 0xad, 0xba,
+  // 23
+  0x05, 0x52, 0x40, 0xcb, 0x41, 0xfb, 0xda, 0x3b, 0xbb, 0xe3, 0x07, 0xd4,
+  0x7e, 0xab, 0x1a, 0x11, 0x93, 0xc8, 0xb3, 0xaf, 0xc9, 0xb5, 0x3d, 0x25,
+  0x48, 0x12, 0x08, 0xb4, 0xe8, 0x76, 0x48, 0x49, 0xe9, 0x41, 0x08, 0x77,
+  0xc5, 0x39, 0xcb, 0x11, 0x6f, 0xa5, 0x56, 0xeb, 0xe1, 0xa8, 0x9a, 0xe3,
+  0xfe, 0x9c, 0xc9, 0x6d, 0x52, 0x84, 0xb4, 0x1a, 0x5f, 0xfe, 0xe2, 0x6d,
+  0xf5, 0xfa, 0x13, 0x77, 0x88, 0xaa, 0x17, 0x94, 0x89, 0x7e, 0x44, 0xf9,
+  0x57, 0xd0, 0x63, 0x8f, 0x00, 0xa5, 0xf2, 0x2e, 0xbe, 0x47, 0x1b, 0x5e,
+  0x12, 0x8d, 0xe1, 0x80, 0x85, 0xe5, 0xe8, 0xde, 0xde, 0xfc, 0x9b, 0xc4,
+  0xc9, 0xd7, 0x85, 0xf6, 0x93, 0xcb, 0x3e, 0x80, 0x6d, 0xc7, 0xdc, 0x68,
+  0x29, 0xd6, 0x55, 0x97, 0x0a, 0xf7, 0xfb, 0xca, 0x12, 0xbb, 0x0f, 0x3a,
+  0x57, 0x5f, 0x14, 0x4d, 0x46, 0x7e, 0xc6, 0x20, 0x7f, 0xa3, 0x55, 0x25,
+  0x93, 0x0c, 0xbc, 0xc7, 0x90, 0x76, 0xa2, 0xf4, 0x8f, 0x00, 0xd6, 0x47,
+  0x6d, 0x3f, 0xa9, 0x53, 0x34, 0x92, 0x0d, 0x28, 0xf9, 0x60, 0xac, 0x11,
+  0x73, 0xff, 0x0c, 0x58, 0x12, 0x6e, 0x6b, 0x06, 0x10, 0xa5, 0x1b, 0xf5,
+  0x69, 0x46, 0xd9, 0x92, 0xa2, 0x2e, 0x35, 0x5b, 0x6c, 0x74, 0x4f, 0x8b,
+  0xec, 0x8d, 0xcb, 0x85, 0xa3, 0x8e, 0xab, 0x5e, 0x8b, 0x75, 0xa2, 0xb9,
+  0xd6, 0xd1, 0x80, 0x85, 0xc3, 0x69, 0xfc, 0x1c, 0xe3, 0x08, 0xe3, 0x50,
+  0xc6, 0x62, 0x71, 0xe6, 0x6d, 0x00, 0x64, 0x49, 0xaa, 0xb3, 0xf3, 0x95,
+  0x14, 0x9e, 0xd2, 0xb6, 0xd7, 0xa9, 0x60, 0x1c, 0x2a, 0x0a, 0x96, 0xe5,
+  0x92, 0x1c, 0xfe, 0x44, 0x10, 0xe4, 0x35, 0xa2, 0x52, 0xf3, 0xa2, 0x75,
+  0xab, 0xa5, 0xe1, 0x06, 0x6d, 0x4b, 0x8b, 0xdc, 0xe3, 0x1d, 0x65, 0x71,
+  0x46, 0xc6, 0x51, 0x33, 0x25, 0xaf, 0xbe, 0xd7, 0xe6, 0xff, 0x07, 0x4d,
+  0xe6, 0x57, 0x36, 0x6f, 0x4e, 0x5b, 0xbd, 0xac, 0x4c, 0xab, 0x1d, 0x47,
+  0x5b, 0x90, 0x8a, 0xcf, 0xb2, 0xf1, 0x45, 0x0a, 0xf1, 0xc8, 0xbd, 0xd3,
+  0x8c, 0xb8, 0xf3, 0x86, 0x49, 0xf4, 0x31, 0x93, 0x8c, 0x18, 0x8e, 0xe2,
+  0x5d, 0x50, 0x1c, 0x0e, 0xc1, 0x66, 0x51, 0x5a, 0x58, 0xbb, 0xf3, 0x93,
+  0xeb, 0xb7, 0xad, 0x41, 0xbc, 0xf1, 0xb1, 0xb1, 0xd4, 0x92, 0x8c, 0x80,
+  0x46, 0xb7, 0x82, 0x62, 0xd0, 0x62, 0x86, 0xa1, 0x0a, 0x8e, 0xbc, 0x0a,
+  0xc8, 0x6e, 0xc6, 0xf7, 0x2f, 0xba, 0x05, 0xda, 0x67, 0xc9, 0xe8, 0x7c,
+  0xc7, 0xd9, 0x27, 0xf4, 0x09, 0x9d, 0xa2, 0x0a, 0xae, 0x08, 0x17, 0xf1,
+  0xe9, 0x08, 0x6d, 0x27, 0x1f, 0x1a, 0x26, 0x7d, 0xe7, 0x40, 0xf3, 0x52,
+  0x6d, 0x94, 0x57, 0xf2, 0xfa, 0x9b, 0xc0, 0xe8, 0xac, 0x77, 0x64, 0xa4,
+  // 24
+  0x8a, 0x1c, 0x6a, 0xb1, 0x86, 0x36, 0xe8, 0xfc, 0xa5, 0xfd, 0xd0, 0xd5,
+  0x97, 0x61, 0xdb, 0xa9, 0xea, 0xc0, 0x18, 0x90, 0x89, 0xe1, 0x6d, 0x0c,
+  0x94, 0x79, 0xde, 0x9e, 0x70, 0x0b, 0xa5, 0x71, 0x74, 0x91, 0xfd, 0x7f,
+  0xdf, 0xc8, 0x3c, 0xd1, 0x7f, 0x78, 0xdd, 0xcb, 0x58, 0x73, 0x66, 0xcd,
+  0x45, 0xe8, 0x0a, 0x77, 0xdd, 0x08, 0xd4, 0x44, 0x1d, 0x59, 0x11, 0xcf,
+  0x6f, 0xac, 0x69, 0x07, 0xa3, 0x40, 0x19, 0xc4, 0x92, 0xff, 0x22, 0x4f,
+  0x53, 0xbe, 0x66, 0x06, 0xd5, 0x3b, 0x5a, 0x48, 0xd8, 0x96, 0x0b, 0x73,
+  0x98, 0x2a, 0x0d, 0x41, 0xf2, 0x0a, 0x19, 0x44, 0x20, 0xf3, 0x94, 0x97,
+  0x26, 0xad, 0xc3, 0xb4, 0x6b, 0x97, 0xd2, 0x71, 0x4c, 0x7f, 0x4d, 0xb3,
+  0xe4, 0xad, 0xed, 0x32, 0xdd, 0xca, 0x06, 0x86, 0x4d, 0x34, 0xde, 0xb2,
+  0x2d, 0x79, 0xba, 0x3d, 0x62, 0xde, 0xc2, 0x77, 0x3a, 0x75, 0x0f, 0x4f,
+  0xf1, 0x70, 0x6c, 0x5e, 0x54, 0x23, 0xb0, 0x75, 0x79, 0xdc, 0xd3, 0xe0,
+  0x54, 0x27, 0x9b, 0xba, 0x65, 0x6f, 0x1d, 0x46, 0xe2, 0xb1, 0x88, 0x5d,
+  0xaa, 0x46, 0x78, 0x3a, 0xa4, 0x10, 0x5a, 0x5a, 0xbc, 0xc9, 0xb4, 0x73,
+  0x9c, 0x12, 0x58, 0x07, 0x63, 0x20, 0xad, 0xe0, 0x09, 0x9a, 0x87, 0x1a,
+  0xb5, 0x3d, 0x4f, 0xb0, 0xbd, 0x2d, 0x62, 0x8f, 0x5f, 0x05, 0xfc, 0x22,
+  0x8c, 0x7d, 0x65, 0x6f, 0x4d, 0x94, 0x4e, 0x9d, 0x1c, 0x23, 0x2b, 0x1e,
+  0xcf, 0x8f, 0xf7, 0xc7, 0x9c, 0x8c, 0x0a, 0x4a, 0xd8, 0xf7, 0xce, 0x34,
+  0xee, 0x3e, 0x6a, 0x49, 0x17, 0x4a, 0x44, 0x2a, 0x75, 0x72, 0x26, 0x8b,
+  0x60, 0xcb, 0x10, 0x95, 0xcc, 0xd1, 0x8b, 0x12, 0x9f, 0xcf, 0x75, 0x9c,
+  0xa2, 0xaf, 0xde, 0x17, 0xad, 0x63, 0x09, 0xd2, 0x43, 0x36, 0xa8, 0x81,
+  0x37, 0xf1, 0xcc, 0xf7, 0x42, 0xc2, 0xbc, 0x27, 0x5c, 0x1a, 0x56, 0xf5,
+  0xb1, 0x78, 0x08, 0x1a, 0xa3, 0x43, 0xb2, 0x9b, 0xc9, 0x52, 0x00, 0x32,
+  0xe3, 0x9e, 0x22, 0x56, 0xed, 0x4a, 0x38, 0x4c, 0x2c, 0xd7, 0x75, 0xfe,
+  0x4e, 0x77, 0x4f, 0x5a, 0x57, 0xd9, 0x93, 0x77, 0x7f, 0x06, 0x59, 0x7b,
+  0x55, 0xc3, 0xa3, 0xcf, 0x9e, 0x58, 0x73, 0x15, 0xee, 0x51, 0xcc, 0x0c,
+  0x87, 0xe1, 0x74, 0xb5, 0x98, 0x10, 0xcf, 0x61, 0x03, 0x5a, 0x77, 0xc0,
+  0x8a, 0x91, 0x57, 0x31, 0x3b, 0x93, 0xc5, 0x2d, 0x10, 0x30, 0x67, 0x47,
+  0x5e, 0x03, 0xc6, 0x21, 0x7a, 0x0e, 0xf1, 0x5b, 0x58, 0x9f, 0x0b, 0xc8,
+  0x88, 0x44, 0x28, 0x21, 0x54, 0x11, 0xe8, 0xee, 0x2c, 0x4b, 0x2d, 0x5b,
+  0xd2, 0x73, 0x96, 0xd0, 0xa3, 0xf3, 0xc7, 0x7f, 0x95, 0x53, 0xd8, 0xe4,
+  0x3c, 0xc4, 0xb9, 0x1e, 0x56, 0xb0, 0xf5, 0x66, 0x12, 0xf1, 0xb0, 0xea,
+  // 25
+  0xb2, 0x8e, 0x15, 0x77, 0x9f, 0x12, 0x8c, 0xef, 0xab, 0xd5, 0x5e, 0xe7,
+  0xb2, 0x17, 0xc5, 0xe8, 0x0c, 0x33, 0xb5, 0xbb, 0xaf, 0xae, 0xe7, 0x9c,
+  0x94, 0x5c, 0xbd, 0x07, 0x1b, 0x6a, 0xa2, 0x4f, 0x42, 0xc2, 0x76, 0x32,
+  0xe8, 0xc1, 0xf9, 0xd2, 0xda, 0xc8, 0x44, 0x05, 0x9d, 0xd8, 0xf8, 0x46,
+  0x7e, 0x5e, 0x00, 0xef, 0xb6, 0xb7, 0x9f, 0x1e, 0x32, 0x67, 0x44, 0x31,
+  0x49, 0x9f, 0xe4, 0xb7, 0x90, 0x7e, 0x15, 0xfc, 0x04, 0x58, 0x27, 0x00,
+  0xd9, 0xac, 0x93, 0x35, 0x65, 0x6b, 0xc5, 0xde, 0x52, 0x55, 0xb3, 0x6e,
+  0xac, 0x62, 0x67, 0x73, 0xa2, 0x33, 0xc4, 0xe6, 0xbc, 0xb4, 0x77, 0x17,
+  0xe4, 0xf3, 0xfa, 0x8f, 0x64, 0xe3, 0xdc, 0xeb, 0x21, 0x3e, 0x3c, 0x60,
+  0x7e, 0xcf, 0x62, 0x31, 0xc2, 0xa1, 0x53, 0xfb, 0xa8, 0x3f, 0xa2, 0xff,
+  0x5f, 0x5f, 0xa9, 0xc1, 0xab, 0x92, 0x4e, 0x48, 0xf2, 0x94, 0xbc, 0x23,
+  0x7e, 0x86, 0x76, 0xa2, 0xd2, 0x85, 0xf2, 0xf9, 0x67, 0x06, 0x84, 0xa2,
+  0x9d, 0xfb, 0x50, 0x5c, 0x41, 0xe4, 0x37, 0x36, 0x34, 0xb1, 0xc3, 0x28,
+  0x12, 0x55, 0xb3, 0xad, 0xf6, 0xa7, 0x71, 0xb6, 0xce, 0xc3, 0x59, 0x67,
+  0x3e, 0x43, 0x4d, 0x88, 0x5a, 0x2a, 0x35, 0x56, 0x4d, 0x1b, 0xcb, 0x73,
+  0xf6, 0x02, 0x4b, 0x7b, 0x4c, 0xc2, 0x30, 0x40, 0x7e, 0xb0, 0x50, 0x34,
+  0xf7, 0x36, 0x0c, 0xd4, 0x53, 0xc8, 0x7d, 0x0a, 0x56, 0x60, 0xd0, 0x54,
+  0x35, 0xc0, 0x91, 0xc6, 0xa3, 0x31, 0x77, 0x95, 0x5e, 0x3e, 0x61, 0x74,
+  0xea, 0xe0, 0x7b, 0x80, 0x49, 0xc3, 0x26, 0xa3, 0xd8, 0x10, 0x2d, 0xbf,
+  0x0e, 0xcc, 0x7d, 0x22, 0xd4, 0x73, 0x6b, 0x2b, 0xed, 0x19, 0x41, 0xef,
+  0x02, 0x8a, 0x39, 0xc1, 0x4d, 0x99, 0xa8, 0xbf, 0xf5, 0xab, 0x1c, 0x6c,
+  0x0f, 0x18, 0x0c, 0x6c, 0xfd, 0x23, 0x69, 0x6d, 0x0e, 0x4a, 0x3e, 0x02,
+  0x9d, 0x61, 0x1e, 0x7c, 0x7e, 0x9a, 0x9e, 0xf5, 0xd8, 0xc5, 0x1e, 0x4f,
+  0xb8, 0x0a, 0x92, 0xb7, 0x3b, 0x44, 0xfa, 0x71, 0x92, 0x71, 0x84, 0x68,
+  0x30, 0x69, 0x2f, 0xaa, 0x01, 0x2d, 0x79, 0xa7, 0x3e, 0x06, 0x95, 0xa8,
+  0x18, 0x87, 0x6f, 0xd2, 0x79, 0xf2, 0x9b, 0x21, 0x71, 0xf3, 0x1f, 0x66,
+  0xc5, 0x07, 0x53, 0x7e, 0x45, 0x3f, 0xfc, 0x1b, 0x5f, 0xd8, 0x51, 0xdc,
+  0x37, 0x45, 0xdf, 0x2d, 0x85, 0xa4, 0x83, 0xb1, 0x21, 0xfb, 0xc4, 0x4b,
+  0x5e, 0x50, 0xaf, 0xf8, 0x6d, 0x87, 0xfb, 0xef, 0xcd, 0x08, 0x29, 0x69,
+  0x33, 0xa2, 0x3a, 0xe2, 0x92, 0x94, 0xed, 0x65, 0xf3, 0xac, 0x8c, 0x68,
+  0x94, 0x8b, 0x3a, 0x19, 0x71, 0xc8, 0xc4, 0x61, 0x53, 0x9d, 0x9a, 0x33,
+  0xdd, 0x61, 0xf8, 0x01, 0xb1, 0x74, 0xca, 0xfe, 0x5e, 0xb8, 0x74, 0x94,
+  // 26
+  0x92, 0x47, 0x54, 0x65, 0x1b, 0x85, 0x9d, 0x12, 0x2a, 0xe5, 0xc1, 0x9d,
+  0xde, 0xf9, 0x65, 0x80, 0x64, 0x07, 0x6e, 0x2c, 0xea, 0xbd, 0x7a, 0xa1,
+  0xf1, 0x49, 0x32, 0x58, 0x79, 0x15, 0xf8, 0xc3, 0x95, 0x73, 0x74, 0x41,
+  0xf8, 0xad, 0x35, 0x88, 0x66, 0x2d, 0xe2, 0xf6, 0x64, 0x31, 0x3e, 0x6b,
+  0x5b, 0xd9, 0xf5, 0x2e, 0xa9, 0xce, 0xdd, 0x0a, 0x11, 0xfe, 0x23, 0xf4,
+  0x2f, 0x2d, 0xc6, 0x30, 0x36, 0xee, 0xca, 0x77, 0x63, 0xb5, 0xdb, 0x02,
+  0xe4, 0x9d, 0xac, 0xac, 0xe6, 0xec, 0xb3, 0xd8, 0x47, 0x1b, 0x14, 0x53,
+  0x4e, 0xa1, 0xdd, 0x37, 0xa7, 0x5d, 0xc3, 0x11, 0x60, 0xca, 0xa3, 0x14,
+  0x5e, 0xf1, 0x46, 0x5f, 0xe1, 0x0d, 0xcc, 0xff, 0x2d, 0x69, 0xaa, 0xf3,
+  0xe1, 0xaf, 0x66, 0x0d, 0x65, 0x1b, 0xec, 0xb9, 0xfc, 0x6a, 0x8c, 0x7f,
+  0xe6, 0x43, 0xa2, 0x3a, 0x8f, 0xd2, 0xcd, 0xe0, 0xab, 0xb1, 0x63, 0x36,
+  0x76, 0x4b, 0x13, 0x5f, 0x81, 0xf9, 0xec, 0xfd, 0x76, 0x71, 0x00, 0x89,
+  0xac, 0xed, 0x45, 0x3f, 0xe6, 0x31, 0x12, 0x01, 0xd3, 0x45, 0x80, 0xcc,
+  0x74, 0xc1, 0xcf, 0x5a, 0x09, 0x34, 0xfd, 0xcf, 0xf2, 0x90, 0xc2, 0x04,
+  0xf1, 0x55, 0x4a, 0xae, 0x58, 0xa1, 0xce, 0xd3, 0x3c, 0xbb, 0x01, 0x2d,
+  0x4d, 0xb6, 0x82, 0x1c, 0xbf, 0x02, 0x18, 0x1f, 0x3a, 0x1b, 0x37, 0x91,
+  0x46, 0x96, 0x2e, 0x7a, 0x9e, 0xec, 0x6a, 0xb2, 0x81, 0xc7, 0x5b, 0x8a,
+  0x34, 0x05, 0xdf, 0xfb, 0xd8, 0x2f, 0xf7, 0x73, 0xb1, 0x0d, 0x62, 0xf5,
+  0x77, 0x6d, 0xd9, 0xef, 0xa1, 0x49, 0xeb, 0xf9, 0x89, 0x40, 0x98, 0x3a,
+  0xa7, 0x59, 0x24, 0xcf, 0x7d, 0x46, 0x83, 0xe0, 0x52, 0xff, 0x49, 0xfe,
+  0x5f, 0xbb, 0xb4, 0xe8, 0x52, 0x07, 0x2c, 0xcb, 0xcc, 0xe4, 0xf1, 0xe3,
+  0x53, 0x5f, 0xe3, 0x53, 0xef, 0x25, 0xb6, 0x3c, 0xb5, 0x5d, 0x63, 0xcb,
+  0x6c, 0x27, 0x84, 0x1e, 0x3a, 0x39, 0x52, 0x70, 0xcd, 0x7c, 0x6b, 0xd7,
+  0x33, 0xf1, 0xc0, 0x77, 0x85, 0x96, 0xce, 0xcb, 0xf4, 0xd1, 0x01, 0x33,
+  0x19, 0x32, 0xef, 0x36, 0x11, 0xfd, 0xa8, 0x2f, 0xee, 0xd4, 0x76, 0xcd,
+  0x3a, 0x8e, 0x97, 0xeb, 0x37, 0x31, 0x43, 0x16, 0xb4, 0xd0, 0x3a, 0xc3,
+  0x6a, 0x12, 0x85, 0x37, 0x79, 0xcb, 0xc2, 0x4f, 0xac, 0xd0, 0x00, 0x3f,
+  0x3b, 0x44, 0x16, 0xc4, 0x3a, 0xad, 0x31, 0x43, 0xe6, 0x6c, 0xc8, 0xb4,
+  0x1a, 0x12, 0x63, 0x23, 0xce, 0xb9, 0xe9, 0xba, 0xa0, 0xa1, 0x29, 0x55,
+  0xfe, 0x94, 0x23, 0x96, 0x81, 0x8d, 0x8f, 0xf9, 0xc6, 0x09, 0x6a, 0xdd,
+  0xd1, 0xb5, 0xc6, 0xa0, 0x22, 0xa6, 0x34, 0x57, 0x30, 0x78, 0x35, 0x36,
+  0x7f, 0x70, 0x0b, 0x84, 0xfd, 0x5c, 0xbc, 0x2d, 0xdb, 0xb9, 0x38, 0xf8,
+  // 27
+  0xdb, 0x64, 0xa5, 0xf9, 0x89, 0x9c, 0x11, 0x5b, 0x44, 0x5d, 0x12, 0xd1,
+  0x18, 0x0d, 0x77, 0x18, 0x6a, 0x98, 0x61, 0xc9, 0x93, 0xfb, 0x2b, 0x87,
+  0x64, 0x69, 0x5f, 0xa9, 0x48, 0x9e, 0x42, 0xe9, 0xe7, 0x29, 0xc7, 0xfd,
+  0x65, 0x3a, 0xd5, 0x65, 0x5c, 0x51, 0x5d, 0xdc, 0xd8, 0x8e, 0x2e, 0x5c,
+  0xec, 0x17, 0x96, 0x81, 0xb6, 0x95, 0xca, 0xfb, 0xf9, 0xa0, 0x9e, 0xe9,
+  0x07, 0x26, 0xb6, 0x82, 0x72, 0xe7, 0x89, 0x7a, 0x17, 0xe9, 0xc2, 0x82,
+  0xae, 0x08, 0xf4, 0x73, 0xbd, 0xe2, 0x85, 0xab, 0x7a, 0xee, 0xdf, 0xcd,
+  0x3c, 0xb9, 0x77, 0x40, 0x2c, 0xd6, 0x15, 0xe8, 0xfb, 0xe7, 0xbf, 0x89,
+  0xfe, 0x45, 0x87, 0xe8, 0xb0, 0x31, 0xc1, 0xb0, 0x85, 0xd2, 0x0e, 0xa0,
+  0x6f, 0xd6, 0xbe, 0x76, 0x67, 0x3a, 0xd2, 0xfe, 0x14, 0x4c, 0x08, 0x03,
+  0xfb, 0x51, 0x31, 0xb3, 0x8c, 0x56, 0x87, 0x58, 0x28, 0xc2, 0x5f, 0xa4,
+  0x16, 0xcb, 0xb9, 0xa8, 0xb7, 0xb5, 0x21, 0xa1, 0x55, 0xeb, 0x63, 0xf1,
+  0x59, 0xd7, 0x9f, 0xf7, 0xc5, 0xad, 0xfe, 0xdc, 0xe7, 0x95, 0x9d, 0x52,
+  0x06, 0xbe, 0x67, 0x4a, 0xf0, 0x5e, 0xa3, 0x00, 0xdb, 0xa6, 0x9d, 0x3d,
+  0xe8, 0x92, 0x0a, 0xcb, 0x25, 0xaf, 0xda, 0x16, 0x4c, 0xbe, 0x2d, 0xd0,
+  0xf0, 0x60, 0x47, 0x97, 0x55, 0xe9, 0xbc, 0x0f, 0xc6, 0x1a, 0x79, 0x5e,
+  0x99, 0xb1, 0xfa, 0x0c, 0xea, 0x81, 0x09, 0x75, 0x52, 0x95, 0xc2, 0x6d,
+  0x2c, 0x0e, 0x1a, 0xcb, 0xcd, 0x65, 0x19, 0x61, 0x96, 0xaa, 0x49, 0x37,
+  0x98, 0xcd, 0xa9, 0xc0, 0xfb, 0xc1, 0x6d, 0xaf, 0x3b, 0x18, 0x66, 0x2b,
+  0x6f, 0x92, 0xe2, 0x43, 0x46, 0xbc, 0x47, 0x30, 0x6d, 0x08, 0x67, 0xd7,
+  0xb3, 0xc5, 0x6b, 0xd4, 0x84, 0xce, 0x57, 0x9f, 0xa6, 0x12, 0x8b, 0x56,
+  0x98, 0x3e, 0x7c, 0x3c, 0x5b, 0x12, 0x4b, 0xd7, 0xcc, 0x99, 0x7e, 0x2f,
+  0x42, 0xce, 0x8a, 0x8e, 0x71, 0x66, 0xbe, 0x1e, 0xed, 0x99, 0x38, 0x85,
+  0x49, 0xac, 0xa9, 0x5a, 0x34, 0xc3, 0xea, 0xf0, 0x7a, 0x51, 0x3c, 0x70,
+  0x26, 0x13, 0x4e, 0xf4, 0xa3, 0xe1, 0xe1, 0x41, 0x6d, 0x0d, 0x28, 0x41,
+  0x90, 0x7e, 0x34, 0x5c, 0x76, 0x2e, 0xab, 0x25, 0x52, 0x6b, 0x48, 0xf9,
+  0x2f, 0xfc, 0xa6, 0x07, 0xad, 0xe6, 0xba, 0xc4, 0xaf, 0x23, 0xfc, 0x55,
+  0xaa, 0xc3, 0x9d, 0x0c, 0x81, 0x23, 0xa0, 0x23, 0x51, 0x29, 0xab, 0x6b,
+  0x0a, 0x99, 0xc1, 0x04, 0x14, 0xde, 0xd5, 0xcc, 0x35, 0x12, 0xbd, 0x2c,
+  0x83, 0x32, 0x24, 0x2c, 0x75, 0xff, 0x30, 0x9f, 0xf4, 0x63, 0xbf, 0xf2,
+  0x90, 0xd6, 0x29, 0x26, 0xeb, 0x44, 0xe4, 0x97, 0x5b, 0x53, 0x67, 0xcf,
+  0x2a, 0xba, 0x94, 0x02, 0xf2, 0xcf, 0xac, 0xe5, 0x4a, 0x9e, 0x1c, 0xda,
+  // 28
+  0x72, 0xcf, 0xcd, 0xf8, 0xe6, 0x6c, 0x96, 0xf7, 0x7f, 0xe8, 0x39, 0xfe,
+  0x83, 0xbd, 0xe9, 0x89, 0x08, 0x2b, 0xc9, 0x41, 0x49, 0x53, 0xfb, 0xd9,
+  0x39, 0xf7, 0x58, 0xbf, 0x24, 0x27, 0xca, 0x69, 0x38, 0xbf, 0x6c, 0x02,
+  0x39, 0xcc, 0x42, 0xf5, 0xe5, 0x94, 0x11, 0xf3, 0x70, 0xf5, 0x67, 0xca,
+  0xda, 0x85, 0xd4, 0x48, 0x68, 0x02, 0x65, 0xa5, 0xf7, 0x61, 0x04, 0xfb,
+  0x35, 0x6a, 0x1b, 0x89, 0xdf, 0x6f, 0x83, 0x68, 0x71, 0xe6, 0x63, 0xaf,
+  0x3a, 0xae, 0x4a, 0x1f, 0xdb, 0xf5, 0x5c, 0xee, 0x3c, 0x06, 0x56, 0x5d,
+  0x5a, 0x1f, 0xc0, 0x26, 0x0f, 0x6c, 0x3a, 0x67, 0x0a, 0x73, 0x33, 0x20,
+  0x7e, 0x2c, 0x25, 0xbd, 0x09, 0xbf, 0xd5, 0x65, 0x57, 0xd4, 0x8f, 0x24,
+  0xdc, 0x25, 0x20, 0x08, 0x5c, 0xcf, 0xc3, 0x57, 0x91, 0x0c, 0x23, 0x83,
+  0x5a, 0xa1, 0x6f, 0x76, 0xf8, 0x68, 0xdf, 0xcf, 0xb3, 0x21, 0xf0, 0xb9,
+  0xc3, 0x74, 0xb6, 0x59, 0x25, 0x13, 0x51, 0xc0, 0x10, 0xd2, 0x13, 0x55,
+  0xd2, 0xb1, 0xf5, 0x13, 0x96, 0x67, 0x2c, 0x88, 0x87, 0xc4, 0x4d, 0xea,
+  0x7e, 0x48, 0xb9, 0x7b, 0x59, 0x6c, 0xe3, 0xa7, 0x05, 0x3b, 0x85, 0xd3,
+  0xf9, 0xe7, 0xd8, 0x15, 0xdb, 0x8c, 0x0b, 0x21, 0xb2, 0x1c, 0x0c, 0x85,
+  0x2c, 0xac, 0x70, 0x14, 0xb2, 0xdf, 0x5c, 0x79, 0x9d, 0x9f, 0x73, 0xdb,
+  0xaf, 0xdd, 0xfb, 0xa2, 0x28, 0xc3, 0x75, 0x41, 0x1e, 0x38, 0xb7, 0x14,
+  0x6a, 0x24, 0xe4, 0xdb, 0x6a, 0x00, 0x89, 0x10, 0xaa, 0xbc, 0x3a, 0xb0,
+  0x40, 0xb7, 0xad, 0x0c, 0x08, 0xa1, 0x32, 0x60, 0x83, 0x46, 0x5f, 0xc1,
+  0xcb, 0x82, 0x49, 0x1e, 0xbf, 0x7a, 0x34, 0xf4, 0x2f, 0x40, 0x52, 0x3b,
+  0x69, 0xb7, 0x51, 0x1d, 0x06, 0xe4, 0x11, 0xb9, 0x08, 0x84, 0x9b, 0x54,
+  0x55, 0x6a, 0xad, 0x87, 0x48, 0xef, 0x67, 0x5d, 0x04, 0x15, 0xa2, 0xf0,
+  0x65, 0x41, 0x75, 0xde, 0x8c, 0x3d, 0x7d, 0x93, 0x3b, 0xab, 0x70, 0x25,
+  0x58, 0x54, 0xff, 0x37, 0x3e, 0x74, 0xa1, 0xb1, 0x4c, 0x72, 0x19, 0x17,
+  0x9d, 0xf9, 0x76, 0x61, 0x17, 0x00, 0x80, 0x3c, 0x4b, 0xd0, 0x0d, 0xf4,
+  0xed, 0x6a, 0x2f, 0x75, 0x2e, 0x02, 0xad, 0x1b, 0x67, 0x5a, 0x52, 0x28,
+  0x20, 0x93, 0xcb, 0xb9, 0x5c, 0x1f, 0x7e, 0x5a, 0xe3, 0x0b, 0x08, 0xcd,
+  0x64, 0x40, 0x0f, 0xc5, 0x95, 0x29, 0x4d, 0xf8, 0x7b, 0x59, 0x73, 0x46,
+  0x58, 0xc1, 0xbb, 0xb1, 0x9d, 0x2d, 0x54, 0x43, 0x56, 0x32, 0xdc, 0x4e,
+  0x86, 0xc0, 0x5a, 0x80, 0xe0, 0xdf, 0x5d, 0x7d, 0x5a, 0x24, 0xd6, 0x66,
+  0xec, 0xef, 0x20, 0x48, 0xcd, 0xb6, 0xd9, 0x7a, 0x9e, 0xdf, 0x63, 0x66,
+  0xa2, 0x95, 0x20, 0x2c, 0xd0, 0xe3, 0x75, 0xce, 0xea, 0x71, 0x9f, 0x05,
+  // 29
+  0x3e, 0x0f, 0x05, 0xdc, 0x80, 0x1e, 0xf2, 0xd5, 0xed, 0x69, 0x6c, 0xb4,
+  0x4f, 0xe4, 0x0b, 0x43, 0x9f, 0x4e, 0x29, 0x2f, 0x6c, 0xeb, 0xb1, 0x9b,
+  0xcf, 0xd0, 0x1f, 0xaa, 0x9f, 0xf7, 0x5b, 0x26, 0x17, 0xa5, 0x9e, 0xbe,
+  0xaa, 0xd6, 0x18, 0x88, 0xd9, 0x50, 0x48, 0xce, 0x18, 0x62, 0xfd, 0x3a,
+  0x65, 0x72, 0xf2, 0x02, 0x6d, 0x97, 0x76, 0x07, 0x74, 0x8f, 0x04, 0x0c,
+  0x26, 0x54, 0x61, 0x42, 0xbd, 0x6b, 0x26, 0x2f, 0x5e, 0xdc, 0x6d, 0xe0,
+  0x5c, 0x5c, 0x07, 0xb2, 0x87, 0x0d, 0xd3, 0x19, 0x43, 0x87, 0x29, 0xff,
+  0x76, 0x2e, 0xe5, 0xe8, 0x35, 0x1e, 0x6a, 0x95, 0x4c, 0x32, 0x8f, 0xc6,
+  0x9a, 0x6b, 0xe4, 0xba, 0x7b, 0xab, 0xeb, 0xaf, 0x59, 0xe8, 0x83, 0x95,
+  0x54, 0x23, 0x60, 0x5d, 0x3d, 0xbe, 0x04, 0x11, 0xfb, 0x73, 0xfb, 0x15,
+  0x41, 0x26, 0x33, 0xe1, 0x97, 0x44, 0xe1, 0x03, 0x4d, 0xf5, 0x23, 0x34,
+  0x98, 0x9b, 0xe8, 0x88, 0xe7, 0x34, 0x19, 0x6e, 0x59, 0xd0, 0xc1, 0xee,
+  0x16, 0xaf, 0x0f, 0x1a, 0x36, 0xbc, 0x83, 0x7e, 0x6e, 0x0f, 0x9e, 0xe8,
+  0x36, 0x60, 0xf9, 0xf1, 0x81, 0x76, 0x20, 0x34, 0x38, 0xfc, 0x70, 0x49,
+  0x13, 0x6e, 0xcd, 0xd0, 0xb4, 0x43, 0x07, 0x9e, 0x97, 0xa3, 0x66, 0x88,
+  0x4b, 0x2d, 0xed, 0x6f, 0x19, 0x3c, 0x11, 0xd3, 0xb7, 0xaf, 0xa6, 0xd2,
+  0xa8, 0x18, 0xfb, 0xd2, 0x9b, 0xb4, 0x3e, 0x3e, 0x60, 0xcc, 0x8c, 0x20,
+  0x3a, 0xa9, 0x33, 0x29, 0xa6, 0x77, 0xf1, 0x72, 0x77, 0x14, 0x7f, 0xdd,
+  0x87, 0x3e, 0xc9, 0x4f, 0x00, 0x75, 0xcd, 0xb2, 0x1d, 0x35, 0x4b, 0xcf,
+  0x24, 0x60, 0x97, 0xcf, 0x91, 0xbe, 0xbc, 0x93, 0xba, 0x4d, 0x91, 0x08,
+  0xe5, 0xaf, 0x78, 0xdc, 0x0d, 0x1e, 0xd0, 0x41, 0xd0, 0x30, 0xda, 0x8b,
+  0xa2, 0x74, 0x6f, 0x3d, 0x1c, 0x02, 0xc1, 0x79, 0x56, 0x32, 0xb9, 0xe8,
+  0x20, 0x50, 0x43, 0x50, 0x0b, 0x7b, 0x95, 0xcb, 0x14, 0x84, 0x4e, 0x0b,
+  0xff, 0x9c, 0xe3, 0x18, 0xd1, 0x19, 0x09, 0x6b, 0x30, 0x76, 0xb3, 0xe6,
+  0xbd, 0xf3, 0xf2, 0xcb, 0xbc, 0xf0, 0x19, 0x7f, 0x3d, 0xf7, 0x1c, 0x08,
+  0x0e, 0xc8, 0x2a, 0x0e, 0x48, 0x45, 0xbd, 0x3c, 0xcf, 0x1d, 0xbd, 0xf0,
+  0xc0, 0x83, 0x06, 0x91, 0x19, 0x89, 0x66, 0xfc, 0xbe, 0x4b, 0x27, 0x1c,
+  0x77, 0xaf, 0x7a, 0x13, 0x45, 0x90, 0x2f, 0xaa, 0x39, 0xc9, 0x00, 0x46,
+  0x44, 0x06, 0x7b, 0xc9, 0x1d, 0x1f, 0xea, 0x77, 0xc0, 0xeb, 0x3c, 0x07,
+  0x2c, 0x0f, 0x36, 0xc0, 0x52, 0x98, 0x34, 0x31, 0xd8, 0xec, 0xd9, 0xa0,
+  0x18, 0xf4, 0xe9, 0x72, 0x42, 0x98, 0x1e, 0x48, 0x83, 0x57, 0x4e, 0xbf,
+  0xda, 0x73, 0xfb, 0x4a, 0x14, 0x71, 0x4d, 0x0a, 0x94, 0x38, 0x1b, 0x1b,
+  // 30
+  0x48, 0x78, 0xc2, 0x2b, 0x5c, 0xf7, 0x2f, 0x30, 0x8d, 0xb6, 0x83, 0x44,
+  0x4a, 0x59, 0xd8, 0x18, 0x19, 0x68, 0x4c, 0xed, 0x59, 0xa7, 0xf8, 0x25,
+  0x26, 0x91, 0x89, 0xc6, 0x34, 0x93, 0x5f, 0x62, 0x45, 0xe1, 0x31, 0x42,
+  0xb4, 0x36, 0xd7, 0x9e, 0x83, 0xba, 0xb6, 0x89, 0x48, 0x14, 0xe3, 0x1c,
+  0xdd, 0x08, 0xa9, 0xc8, 0xff, 0x99, 0x2a, 0xf7, 0xe6, 0x7e, 0x27, 0xe0,
+  0x03, 0x82, 0xa2, 0xf9, 0x17, 0xee, 0x2c, 0x9e, 0x14, 0xd6, 0x34, 0xc8,
+  0xfc, 0x29, 0x2c, 0x61, 0x58, 0x4e, 0xdd, 0x17, 0x09, 0xf7, 0x14, 0x5b,
+  0xa6, 0x82, 0xf6, 0xf9, 0x85, 0x34, 0x26, 0xe2, 0xb6, 0xd9, 0xf0, 0x57,
+  0x36, 0x42, 0x0d, 0x40, 0x64, 0x9b, 0x0b, 0xca, 0x6b, 0x8d, 0x79, 0x48,
+  0x50, 0x81, 0xeb, 0xf1, 0x4c, 0xc3, 0x75, 0xb7, 0xd6, 0xa0, 0x5e, 0x27,
+  0x3d, 0x07, 0xc0, 0x8c, 0x02, 0xd6, 0xaa, 0x38, 0x9c, 0x42, 0x9a, 0xcc,
+  0x01, 0x2d, 0x63, 0xa9, 0x84, 0xc6, 0x47, 0x16, 0x47, 0xd4, 0x64, 0x43,
+  0xa6, 0xa7, 0xe3, 0x99, 0xe1, 0xf1, 0x9d, 0x76, 0xca, 0xe7, 0xa4, 0x5d,
+  0xd5, 0xf8, 0x52, 0xed, 0x5d, 0xe7, 0x67, 0xc1, 0xe5, 0x80, 0x17, 0xab,
+  0x45, 0x16, 0x71, 0x37, 0xe0, 0xde, 0xb4, 0x75, 0x45, 0x94, 0xe1, 0x4a,
+  0x0f, 0x78, 0x4b, 0x0b, 0x5b, 0xd5, 0xab, 0x27, 0xec, 0xc2, 0x3c, 0x64,
+  0xba, 0xd5, 0xfb, 0x74, 0x40, 0xab, 0x95, 0xde, 0xe8, 0x6c, 0x65, 0xb8,
+  0xe6, 0x10, 0x9a, 0xcf, 0x97, 0x6f, 0x14, 0xbf, 0x63, 0xfb, 0xd7, 0x99,
+  0x83, 0x05, 0x52, 0x2a, 0xe6, 0xd4, 0xe3, 0xd3, 0x0b, 0x24, 0x78, 0x1e,
+  0x55, 0xc0, 0xd6, 0xef, 0x8b, 0x95, 0x21, 0x15, 0xb5, 0x7a, 0xb1, 0x50,
+  0x0d, 0x9c, 0x9e, 0xc9, 0x30, 0x1e, 0x81, 0xf1, 0xfd, 0x95, 0x57, 0x27,
+  0xb2, 0xf2, 0x5e, 0xa2, 0xe0, 0x98, 0xb3, 0x3e, 0x65, 0x44, 0x65, 0xaa,
+  0x04, 0x84, 0xd6, 0x25, 0x1b, 0x1f, 0x75, 0x0f, 0x88, 0x87, 0x15, 0xe4,
+  0x53, 0x54, 0x2c, 0xb9, 0xd5, 0xad, 0xed, 0x6b, 0x89, 0x0b, 0x05, 0x90,
+  0x35, 0xd2, 0xef, 0x24, 0x77, 0x1d, 0xef, 0xdd, 0x02, 0x5a, 0x6a, 0x07,
+  0x39, 0x26, 0x2a, 0xb9, 0xbb, 0x3d, 0xa9, 0x32, 0xcd, 0x99, 0xeb, 0x97,
+  0x7a, 0x31, 0xe4, 0x9c, 0xd6, 0x9f, 0xcf, 0x8b, 0x92, 0xd8, 0x0f, 0x38,
+  0x95, 0x26, 0x88, 0x49, 0x1f, 0x63, 0x49, 0xd1, 0xe2, 0x29, 0x67, 0x3c,
+  0xa1, 0x57, 0x59, 0x0f, 0x24, 0x91, 0x4e, 0x0f, 0x38, 0xc1, 0xcb, 0x80,
+  0xcd, 0xad, 0x64, 0x7a, 0xa1, 0x78, 0xb5, 0x4d, 0x3a, 0x36, 0x61, 0xd1,
+  0x83, 0x5d, 0xa3, 0xee, 0x19, 0xaf, 0x23, 0x46, 0x85, 0x5d, 0x7a, 0x41,
+  0xc2, 0xc9, 0x64, 0x78, 0x29, 0x18, 0x9a, 0xc2, 0x3f, 0x22, 0x54, 0xd6,
+  // 31
+  0x6a, 0x5b, 0xca, 0xd8, 0xd0, 0xd3, 0xeb, 0xf2, 0xfb, 0x80, 0xb5, 0xb3,
+  0x52, 0x58, 0x76, 0x43, 0xba, 0x43, 0x1e, 0x17, 0x3f, 0x6b, 0xbb, 0xe8,
+  0x97, 0xd5, 0x62, 0xd6, 0x7c, 0x79, 0x10, 0x77, 0x5b, 0x5a, 0x37, 0xa7,
+  0x49, 0xfe, 0x9a, 0xf6, 0x41, 0x5b, 0x88, 0x34, 0xda, 0x34, 0x6a, 0xb2,
+  0x61, 0x96, 0x37, 0x39, 0x30, 0xc3, 0x93, 0xbc, 0x50, 0x4b, 0xbc, 0xf2,
+  0x1f, 0x2e, 0x1a, 0xa6, 0x27, 0xc5, 0xa9, 0xa8, 0xfa, 0xdd, 0x45, 0xa7,
+  0x08, 0x48, 0x28, 0x70, 0x57, 0x2b, 0xd2, 0xac, 0x3d, 0x87, 0x22, 0xe0,
+  0x9a, 0x56, 0xe5, 0x74, 0x8e, 0x05, 0x65, 0xb6, 0x9e, 0x3a, 0xf9, 0xc6,
+  0x21, 0x11, 0xd6, 0x46, 0x9c, 0x7d, 0x9b, 0x4e, 0x6b, 0x24, 0x3a, 0x58,
+  0x16, 0x3e, 0x7b, 0xd0, 0x36, 0xa8, 0xe6, 0x45, 0x44, 0x3d, 0x7b, 0x86,
+  0x6f, 0x26, 0x46, 0x03, 0x6c, 0xcd, 0x94, 0x15, 0x74, 0x72, 0xbd, 0xc5,
+  0xe9, 0x8d, 0x1e, 0xb5, 0x2e, 0xc9, 0x23, 0xc6, 0x6a, 0x01, 0x25, 0xf2,
+  0xbd, 0xe2, 0x14, 0xdd, 0x8d, 0x14, 0x65, 0xbb, 0xda, 0x23, 0x42, 0x7f,
+  0x0d, 0x54, 0x4b, 0xe7, 0x36, 0xaf, 0xdd, 0xc2, 0x0a, 0xe9, 0xdf, 0xea,
+  0xf2, 0x64, 0x00, 0xc9, 0x19, 0x9c, 0xee, 0x45, 0x6a, 0x73, 0xfa, 0x69,
+  0x83, 0x41, 0x55, 0xbc, 0x98, 0x9b, 0xf9, 0x81, 0x71, 0x94, 0x5f, 0xbb,
+  0xc2, 0x8f, 0x72, 0x19, 0x2b, 0x4b, 0x67, 0x56, 0xee, 0xf6, 0x78, 0xf9,
+  0x92, 0x4b, 0x63, 0x7e, 0x3f, 0x66, 0x09, 0xcc, 0x84, 0x9e, 0xe3, 0x35,
+  0xb0, 0xee, 0xce, 0xdf, 0xec, 0xd0, 0x5c, 0x06, 0xfe, 0x21, 0x0f, 0x1a,
+  0xc2, 0x2e, 0xc7, 0xc8, 0xa4, 0x17, 0x7f, 0x53, 0xf2, 0x6b, 0x71, 0x80,
+  0x2e, 0x9c, 0x8b, 0x93, 0x65, 0xed, 0xc5, 0x8c, 0x46, 0xb7, 0x9c, 0xb9,
+  0x7a, 0x6b, 0x5e, 0xfa, 0xba, 0xa6, 0x5e, 0x8c, 0x1b, 0x39, 0x41, 0xed,
+  0x29, 0x9c, 0xa9, 0xb5, 0x2e, 0xc1, 0x5a, 0x43, 0x1f, 0xb8, 0xfc, 0x1e,
+  0x43, 0x9e, 0xd3, 0x23, 0x78, 0xce, 0x93, 0x94, 0x06, 0x55, 0x37, 0x09,
+  0x61, 0x28, 0xfd, 0x29, 0x78, 0x8c, 0x7b, 0x79, 0xed, 0x37, 0x7d, 0x43,
+  0xd3, 0x99, 0x74, 0x02, 0xd9, 0x50, 0x7b, 0xd7, 0xe9, 0x2e, 0xab, 0x89,
+  0x71, 0xc9, 0x7d, 0x09, 0x57, 0x95, 0x05, 0x55, 0x05, 0xc2, 0x49, 0xa7,
+  0xaa, 0xf8, 0x3f, 0x09, 0x4a, 0xd1, 0x46, 0x01, 0x53, 0x53, 0xe4, 0x22,
+  0x6a, 0xd3, 0xa5, 0xf4, 0x3c, 0x75, 0x28, 0xdf, 0xa4, 0xbf, 0x70, 0xc3,
+  0x49, 0x89, 0xaf, 0x83, 0x1e, 0x79, 0x3a, 0xe1, 0xae, 0x2a, 0x3d, 0xe6,
+  0x4c, 0xf8, 0xd7, 0xa9, 0x9f, 0x6e, 0x9f, 0xd2, 0x4f, 0x50, 0x92, 0x28,
+  0x24, 0xb4, 0x23, 0x8d, 0xcd, 0x7b, 0x05, 0xcb, 0x3b, 0xab, 0xa8, 0x2f
+};
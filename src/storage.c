@@ -1,3 +1,4 @@
+#include <stddef.h>
 #include <string.h>
 #include <ctype.h>
 #include "constants.h"
@@ -32,6 +33,8 @@
 // so max use address of (128 + 80 * 16) = 1408 B
 
 // This storage use [0, 1408) of EEPROM, leave [1408, 4096) for user to use safely.
+// With HOMEKIT_SRP_CACHE, the SRP setup (sizeof(srp_data_t) = 856B) also uses
+// [1408, 2264), leaving [2264, 4096).
 // Leave the FS(file system) for user to use freely.
 
 /*
@@ -51,12 +54,19 @@ Sketch    OTA update   File system   EEPROM  WiFi config (SDK)
 
 #pragma GCC diagnostic ignored "-Wunused-value"
 
+#ifdef ARDUINO_ARCH_ESP8266
 // These two values are provided in tools/sdk/ld/eagle.flash.**.ld
 extern uint32_t _EEPROM_start; //See EEPROM.cpp
 extern uint32_t _SPIFFS_start; //See spiffs_api.h
 
 #define HOMEKIT_EEPROM_PHYS_ADDR ((uint32_t) (&_EEPROM_start) - 0x40200000)
 #define HOMEKIT_SPIFFS_PHYS_ADDR ((uint32_t) (&_SPIFFS_start) - 0x40200000)
+#else
+// Host build: the emulated flash file starts with the storage sector
+#define SPI_FLASH_SEC_SIZE SPI_FLASH_SECTOR_SIZE
+#define HOMEKIT_EEPROM_PHYS_ADDR 0
+#define HOMEKIT_SPIFFS_PHYS_ADDR 0
+#endif
 
 //#ifndef SPIFLASH_BASE_ADDR
 #define STORAGE_BASE_ADDR HOMEKIT_EEPROM_PHYS_ADDR//0x200000
@@ -66,11 +76,13 @@ extern uint32_t _SPIFFS_start; //See spiffs_api.h
 #define ACCESSORY_ID_OFFSET    4
 #define ACCESSORY_KEY_OFFSET   32
 #define PAIRINGS_OFFSET        128
+#define SRP_SETUP_OFFSET       (PAIRINGS_OFFSET + sizeof(pairing_data_t) * MAX_PAIRINGS)
 
 #define MAGIC_ADDR           (STORAGE_BASE_ADDR + MAGIC_OFFSET)
 #define ACCESSORY_ID_ADDR    (STORAGE_BASE_ADDR + ACCESSORY_ID_OFFSET)
 #define ACCESSORY_KEY_ADDR   (STORAGE_BASE_ADDR + ACCESSORY_KEY_OFFSET)
 #define PAIRINGS_ADDR        (STORAGE_BASE_ADDR + PAIRINGS_OFFSET)
+#define SRP_SETUP_ADDR       (STORAGE_BASE_ADDR + SRP_SETUP_OFFSET)
 
 #define MAX_PAIRINGS 16
 
@@ -90,6 +102,15 @@ typedef struct {
     byte _reserved[7]; // align record to be 80 bytes
 } pairing_data_t;
 
+const char magic_srp[] = "SRP";
+
+// Written to erased flash, the magic last
+typedef struct {
+    char magic[sizeof(magic_srp)];
+    uint32_t key_unused; // cleared, without erasing, when the key is used
+    srp_setup_t setup;
+} srp_data_t;
+
 
 int homekit_storage_init() {
 
@@ -228,7 +249,7 @@ static int compact_data() {
         pairing_data_t *pairing_data = (pairing_data_t *)&data[PAIRINGS_OFFSET + sizeof(pairing_data_t)*i];
         if (!strncmp(pairing_data->magic, magic1, sizeof(magic1))) {
             if (i != next_pairing_idx) {
-                memcpy(&data[PAIRINGS_ADDR + sizeof(pairing_data_t)*next_pairing_idx],
+                memcpy(&data[PAIRINGS_OFFSET + sizeof(pairing_data_t)*next_pairing_idx],
                        pairing_data, sizeof(*pairing_data));
             }
             next_pairing_idx++;
@@ -246,7 +267,10 @@ static int compact_data() {
         free(data);
         return -1;
     }
-    if (!spiflash_write(STORAGE_BASE_ADDR, data, PAIRINGS_OFFSET + sizeof(pairing_data_t)*next_pairing_idx)) {
+    // The free pairing records are left erased, the SRP setup is kept
+    memset(&data[PAIRINGS_OFFSET + sizeof(pairing_data_t)*next_pairing_idx], 0xff,
+           sizeof(pairing_data_t)*(MAX_PAIRINGS - next_pairing_idx));
+    if (!spiflash_write(STORAGE_BASE_ADDR, data, SRP_SETUP_OFFSET + sizeof(srp_data_t))) {
         ERROR("Failed to compact HomeKit storage: error writing compacted data");
         free(data);
         return -1;
@@ -264,7 +288,7 @@ static int find_empty_block() {
         spiflash_read(PAIRINGS_ADDR + sizeof(data)*i, data, sizeof(data));
 
         bool block_empty = true;
-        for (int j=0; j<sizeof(data); j++)
+        for (size_t j=0; j<sizeof(data); j++)
             if (data[j] != 0xff) {
                 block_empty = false;
                 break;
@@ -294,7 +318,7 @@ int homekit_storage_add_pairing(const char *device_id, const ed25519_key *device
     memset(&data, 0, sizeof(data));
     strncpy(data.magic, magic1, sizeof(data.magic));
     data.permissions = permissions;
-    strncpy(data.device_id, device_id, sizeof(data.device_id));
+    memcpy(data.device_id, device_id, strnlen(device_id, sizeof(data.device_id)));
     size_t device_public_key_size = sizeof(data.device_public_key);
     int r = crypto_ed25519_export_public_key(
         device_key, data.device_public_key, &device_public_key_size
@@ -437,5 +461,88 @@ int homekit_storage_next_pairing(pairing_iterator_t *it, pairing_t *pairing) {
 }
 
 
+int homekit_storage_load_srp_setup(srp_setup_t *setup, bool *key_unused) {
+    srp_data_t *data = malloc(sizeof(srp_data_t));
+    if (!data)
+        return -1;
+
+    if (!spiflash_read(SRP_SETUP_ADDR, (byte *)data, sizeof(*data))) {
+        ERROR("Failed to read SRP setup from HomeKit storage");
+        free(data);
+        return -1;
+    }
+    if (strncmp(data->magic, magic_srp, sizeof(magic_srp))) {
+        free(data);
+        return -2;
+    }
+
+    memcpy(setup, &data->setup, sizeof(*setup));
+    *key_unused = data->key_unused != 0;
+    free(data);
+
+    return 0;
+}
+
+
+int homekit_storage_save_srp_setup(const srp_setup_t *setup) {
+    byte *sector = malloc(SPI_FLASH_SECTOR_SIZE);
+    if (!sector)
+        return -1;
+
+    if (!spiflash_read(STORAGE_BASE_ADDR, sector, SPI_FLASH_SECTOR_SIZE)) {
+        ERROR("Failed to save SRP setup: sector data read error");
+        free(sector);
+        return -1;
+    }
+
+    bool erased = true;
+    for (size_t i=0; i<sizeof(srp_data_t); i++)
+        if (sector[SRP_SETUP_OFFSET + i] != 0xff) {
+            erased = false;
+            break;
+        }
+
+    if (!erased) {
+        // Rewrite the sector without the previous SRP setup
+        memset(&sector[SRP_SETUP_OFFSET], 0xff, sizeof(srp_data_t));
+        if (!spiflash_erase_sector(STORAGE_BASE_ADDR)
+                || !spiflash_write(STORAGE_BASE_ADDR, sector, SPI_FLASH_SECTOR_SIZE)) {
+            ERROR("Failed to save SRP setup: error rewriting flash");
+            free(sector);
+            return -1;
+        }
+    }
+
+    srp_data_t *data = (srp_data_t *)sector;
+    memset(data->magic, 0xff, sizeof(data->magic));
+    data->key_unused = 0xffffffff;
+    memcpy(&data->setup, setup, sizeof(*setup));
+
+    int r = 0;
+    if (!spiflash_write(SRP_SETUP_ADDR, (byte *)data, sizeof(*data))) {
+        r = -1;
+    } else {
+        strncpy(data->magic, magic_srp, sizeof(data->magic));
+        if (!spiflash_write(SRP_SETUP_ADDR, (byte *)data->magic, sizeof(data->magic)))
+            r = -1;
+    }
+    if (r)
+        ERROR("Failed to write SRP setup to HomeKit storage");
+
+    free(sector);
+
+    return r;
+}
+
+
+void homekit_storage_srp_key_used() {
+    uint32_t key_unused = 0;
+    if (!spiflash_write(SRP_SETUP_ADDR + offsetof(srp_data_t, key_unused),
+                        (byte *)&key_unused, sizeof(key_unused))) {
+        ERROR("Failed to update SRP setup in HomeKit storage");
+    }
+}
+
+
 #undef HOMEKIT_EEPROM_PHYS_ADDR
 #undef HOMEKIT_SPIFFS_PHYS_ADDR
@@ -29,6 +29,21 @@ typedef struct {
     int idx;
 } pairing_iterator_t;
 
+// The SRP setup of the setup code, kept to skip the slow crypto_srp_init and
+// crypto_srp_get_public_key after a reboot (HOMEKIT_SRP_CACHE)
+typedef struct {
+    byte password_hash[32];  // of the password the verifier is for
+    byte salt[16];
+    byte verifier[384];
+    byte private_key[32];    // b, the server key of the next pairing attempt
+    byte public_key[384];    // B
+} srp_setup_t;
+
+// key_unused: false once the server key was used by a pairing attempt
+int homekit_storage_load_srp_setup(srp_setup_t *setup, bool *key_unused);
+int homekit_storage_save_srp_setup(const srp_setup_t *setup);
+void homekit_storage_srp_key_used();
+
 
 void homekit_storage_pairing_iterator_init(pairing_iterator_t *it);
 int homekit_storage_next_pairing(pairing_iterator_t *it, pairing_t *pairing);
@@ -1,3 +1,4 @@
+#include <string.h>
 #include "homekit/types.h"
 
 //=========================
@@ -6,6 +7,7 @@
 
 homekit_value_t HOMEKIT_DEFAULT_CPP() {
 	homekit_value_t homekit_value;
+	memset(&homekit_value, 0, sizeof(homekit_value));
 	//homekit_value.is_null = false;//该值为默认，不用设置
 	return homekit_value;
 }
@@ -12,11 +12,12 @@
 #include "stdint.h"
 #include "stddef.h"
 #include "stdlib.h"
-#include "osapi.h"
 #include "homekit_debug.h"
 
+void homekit_random_fill(uint8_t *data, size_t size); // port.c
+
 static inline int hwrand_generate_block(uint8_t *buf, size_t len) {
-	os_get_random(buf, len);
+	homekit_random_fill(buf, len);
     return 0;
 }
 
@@ -67,11 +68,31 @@ static inline int hwrand_generate_block(uint8_t *buf, size_t len) {
 //winsize=3 & mp_exptmod_fast : ram(heap) is not sufficient
 //force use s_mp_exptmod (lower memory), and smiller performance with mp_exptmod_fast
 #define ESP_FORCE_S_MP_EXPTMOD
+//the modulus N of SRP (all the exponentiations of pair-setup) uses
+//crypto_srp_exptmod in crypto.c: 16-bit Montgomery and a fixed window
+//of CRYPTO_SRP_EXPTMOD_WINSIZE bits (default 4, about 7 KB of heap), and its
+//mp_mulmod crypto_srp_mulmod (Montgomery instead of the long division)
+#define ESP_SRP_EXPTMOD
 //winsize = 5 & mp_exptmod_fast 最快，Pair Verify Step 2/2 = 10s左右
 //winsize = 6 heap不够
 
 
+//ESP_MP_32BIT: 28-bit digits in 32-bit words instead of MP_16BIT (12-bit digits),
+//a 3072-bit number is 110 digits instead of 256 and the products use the comba
+//multiply/square of integer.c (ESP_MP_MULADD, 16x16 products without 64-bit math).
+//With MP_16BIT the 3072-bit products are too long for the comba (MP_WARRAY) and use
+//the schoolbook s_mp_mul_digs/s_mp_sqr.
+//The SRP exponentiations use crypto_srp_exptmod whatever the digits (ESP_SRP_EXPTMOD),
+//this is for the remaining mp_mulmod/mp_mod/mp_invmod
+//#define ESP_MP_32BIT
+
+#ifdef ESP_MP_32BIT
+//comba arrays (malloc, WOLFSSL_SMALL_STACK) for up to 127-digit (3556-bit) operands,
+//the default 512 digits are 2KB
+#define MP_WARRAY 256
+#else
 #define MP_16BIT //faster than 32bit in ESP8266
+#endif
 
 #if defined(ARDUINO_HOMEKIT_LOWROM)
 
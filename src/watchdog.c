@@ -7,11 +7,14 @@
  */
 
 #include "watchdog.h"
-#include "Arduino.h"
 #include "stdint.h"
-#include "user_interface.h"
 #include "homekit_debug.h"
 
+#ifdef ARDUINO_ARCH_ESP8266
+
+#include "Arduino.h"
+#include "user_interface.h"
+
 #define REG_WDT_BASE 0x60000900
 
 #define WDT_CTL (REG_WDT_BASE + 0x0)
@@ -41,6 +44,22 @@ void watchdog_enable_all() {
 	system_soft_wdt_restart();
 }
 
+#else
+
+// Host build: no watchdogs to feed
+void esp_hw_wdt_enable() {
+}
+void esp_hw_wdt_disable() {
+}
+void esp_hw_wdt_feed() {
+}
+void watchdog_disable_all() {
+}
+void watchdog_enable_all() {
+}
+
+#endif
+
 #ifdef HOMEKIT_DEBUG
 
 static uint32_t wdt_checkpoint;
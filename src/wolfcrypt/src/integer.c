@@ -60,6 +60,34 @@
     #endif
 #endif
 
+#ifdef ESP_MP_32BIT
+#if DIGIT_BIT != 28
+   #error "ESP_MP_32BIT needs the 28-bit digits"
+#endif
+/* Comba column accumulation (lo, hi) += x * y of 28-bit digits without the
+ * 64-bit mp_word: the ESP8266 multiplies 16x16 bits in one instruction (MUL16U)
+ * but a 32x32 -> 64 product is a libgcc call, so x * y is the sum of the 4
+ * products of the 16-bit halves. The column sums stay below 2^63. */
+#define ESP_MP_MUL16(x, y) ((mp_digit)(unsigned short)(x) * (unsigned short)(y))
+#define ESP_MP_MULADD(lo, hi, x, y)                                    \
+  do {                                                                 \
+     mp_digit _x = (x), _y = (y), _t;                                  \
+     mp_digit _m = ESP_MP_MUL16(_x, _y >> 16) +                        \
+                   ESP_MP_MUL16(_x >> 16, _y);  /* < 2^29 */           \
+     hi += ESP_MP_MUL16(_x >> 16, _y >> 16) + (_m >> 16);              \
+     _t = _m << 16;                                                    \
+     lo += _t; hi += (lo < _t);                                        \
+     _t = ESP_MP_MUL16(_x, _y);                                        \
+     lo += _t; hi += (lo < _t);                                        \
+  } while (0)
+/* (lo, hi) >>= DIGIT_BIT, the carry to the next column */
+#define ESP_MP_CARRY(lo, hi)                                           \
+  do {                                                                 \
+     lo = (lo >> DIGIT_BIT) | (hi << (32 - DIGIT_BIT));                \
+     hi >>= DIGIT_BIT;                                                 \
+  } while (0)
+#endif
+
 #ifdef SHOW_GEN
     #if defined(FREESCALE_MQX) || defined(FREESCALE_KSDK_MQX)
         #if MQX_USE_IO_OLD
@@ -801,6 +829,13 @@ int mp_lshd (mp_int * a, int b)
 }
 
 
+#ifdef ESP_SRP_EXPTMOD
+/* the SRP group of HomeKit, see crypto.c */
+int crypto_srp_is_modulus(mp_int * P);
+int crypto_srp_exptmod(mp_int * G, mp_int * X, mp_int * P, mp_int * Y);
+int crypto_srp_mulmod(mp_int * A, mp_int * B, mp_int * P, mp_int * Y);
+#endif
+
 /* this is a shell function that calls either the normal or Montgomery
  * exptmod functions.  Originally the call to the montgomery code was
  * embedded in the normal function but that wasted a lot of stack space
@@ -856,6 +891,12 @@ int mp_exptmod (mp_int * G, mp_int * X, mp_int * P, mp_int * Y)
 #endif
   }
 
+#ifdef ESP_SRP_EXPTMOD
+  if (crypto_srp_is_modulus(P)) {
+     return crypto_srp_exptmod(G, X, P, Y);
+  }
+#endif
+
 #ifdef ESP_FORCE_S_MP_EXPTMOD
   return s_mp_exptmod (G, X, P, Y, 0);
 #endif
@@ -2732,6 +2773,13 @@ int mp_mulmod (mp_int * a, mp_int * b, mp_int * c, mp_int * d)
   int     res;
   mp_int  t;
 
+#ifdef ESP_SRP_EXPTMOD
+  if (a->sign == MP_ZPOS && b->sign == MP_ZPOS && crypto_srp_is_modulus(c)
+      && mp_cmp_mag(a, c) == MP_LT && mp_cmp_mag(b, c) == MP_LT) {
+     return crypto_srp_mulmod(a, b, c, d);
+  }
+#endif
+
   if ((res = mp_init_size (&t, c->used)) != MP_OKAY) {
     return res;
   }
@@ -3023,6 +3071,9 @@ int fast_s_mp_sqr (mp_int * a, mp_int * b)
 #endif
   mp_digit  *tmpx;
   mp_word   W1;
+#ifdef ESP_MP_32BIT
+  mp_digit  lo, hi, W1lo = 0, W1hi = 0;
+#endif
 
   /* grow the destination as required */
   pa = a->used + a->used;
@@ -3070,6 +3121,28 @@ int fast_s_mp_sqr (mp_int * a, mp_int * b)
        */
       iy = MIN(iy, (ty-tx+1)>>1);
 
+#ifdef ESP_MP_32BIT
+      lo = hi = 0;
+      for (iz = 0; iz < iy; iz++) {
+         ESP_MP_MULADD(lo, hi, *tmpx++, *tmpy--);
+      }
+
+      /* double the inner product and add carry */
+      hi = (hi << 1) | (lo >> 31);
+      lo <<= 1;
+      lo += W1lo;
+      hi += W1hi + (lo < W1lo);
+
+      if ((ix&1) == 0) {
+         ESP_MP_MULADD(lo, hi, a->dp[ix>>1], a->dp[ix>>1]);
+      }
+
+      W[ix] = lo & MP_MASK;
+
+      ESP_MP_CARRY(lo, hi);
+      W1lo = lo;
+      W1hi = hi;
+#else
       /* execute loop */
       for (iz = 0; iz < iy; iz++) {
          _W += ((mp_word)*tmpx++)*((mp_word)*tmpy--);
@@ -3088,6 +3161,7 @@ int fast_s_mp_sqr (mp_int * a, mp_int * b)
 
       /* make next carry */
       W1 = _W >> ((mp_word)DIGIT_BIT);
+#endif
   }
 
   /* setup dest */
@@ -3141,6 +3215,9 @@ int fast_s_mp_mul_digs (mp_int * a, mp_int * b, mp_int * c, int digs)
   mp_digit W[MP_WARRAY];
 #endif
   mp_word  _W;
+#ifdef ESP_MP_32BIT
+  mp_digit lo = 0, hi = 0;
+#endif
 
   /* grow the destination as required */
   if (c->alloc < digs) {
@@ -3180,6 +3257,15 @@ int fast_s_mp_mul_digs (mp_int * a, mp_int * b, mp_int * c, int digs)
        */
       iy = MIN(a->used-tx, ty+1);
 
+#ifdef ESP_MP_32BIT
+      for (iz = 0; iz < iy; ++iz) {
+         ESP_MP_MULADD(lo, hi, *tmpx++, *tmpy--);
+      }
+
+      W[ix] = lo & MP_MASK;
+
+      ESP_MP_CARRY(lo, hi);
+#else
       /* execute loop */
       for (iz = 0; iz < iy; ++iz) {
          _W += ((mp_word)*tmpx++)*((mp_word)*tmpy--);
@@ -3191,6 +3277,7 @@ int fast_s_mp_mul_digs (mp_int * a, mp_int * b, mp_int * c, int digs)
 
       /* make next carry */
       _W = _W >> ((mp_word)DIGIT_BIT);
+#endif
  }
 
   /* setup dest */
@@ -368,7 +368,7 @@ static int InitSha512(wc_Sha512* sha512)
 
 #endif /* Hardware Acceleration */
 
-#include <pgmspace.h>
+#include <esp_xpgm.h>
 
 static const PROGMEM word64 K512[80] = {
     W64LIT(0x428a2f98d728ae22), W64LIT(0x7137449123ef65cd),
@@ -77,8 +77,8 @@ extern "C" {
 #endif /* __cplusplus */
 
 
-/* detect 64-bit mode if possible */
-#if defined(__x86_64__)
+/* detect 64-bit mode if possible (not with ESP_MP_32BIT, 28-bit digits on a host too) */
+#if defined(__x86_64__) && !defined(ESP_MP_32BIT)
    #if !(defined(MP_64BIT) && defined(MP_16BIT) && defined(MP_8BIT))
       #define MP_64BIT
    #endif
@@ -186,7 +186,9 @@ typedef int           mp_err;
 
 /* size of comba arrays, should be at least 2 * 2**(BITS_PER_WORD -
    BITS_PER_DIGIT*2) */
+#ifndef MP_WARRAY
 #define MP_WARRAY  (1 << (sizeof(mp_word) * CHAR_BIT - 2 * DIGIT_BIT + 1))
+#endif
 
 #ifdef HAVE_WOLF_BIGINT
     struct WC_BIGINT;